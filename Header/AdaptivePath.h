@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include "Curve.h"
+
+struct RouteGeometry;
+
+// Opis: teselacija putanje prilagodjena zakrivljenosti i velicini na ekranu.
+// Broj duzi po segmentu se bira Wang-ovom formulom tako da odstupanje od krive bude ispod zadate
+// tolerancije u pikselima, pa skoro prave i sitne krive dobijaju po nekoliko tacaka umesto 31.
+// Ponovo se racuna samo kad se promeni ruta ili kad se razmera (zoom) promeni dovoljno.
+
+const float PATH_TOLERANCE_PIXELS = 0.25f;
+const int PATH_MAX_SEGMENTS = 256;
+// Razmera moze da poraste za 25% (greska do 1.25x tolerancije) ili da padne na pola pre nove teselacije
+const float PATH_RESCALE_UP = 1.25f;
+const float PATH_RESCALE_DOWN = 0.5f;
+
+// Wang: n = ceil(sqrt(|p0 - 2p1 + p2| / (4 * tolerancija))), sve u pikselima
+int quadraticSegmentsForTolerance(Vec2 p0, Vec2 p1, Vec2 p2, float pixelsPerUnit, float tolerancePixels);
+
+struct AdaptivePath {
+    float tolerancePixels;
+    float builtScale;
+    unsigned int builtVersion;
+    bool built;
+
+    // x, y redom za sve segmente; opseg segmenta i je ranges[i]
+    std::vector<float> vertices;
+    std::vector<DrawRange> ranges;
+
+    AdaptivePath();
+
+    // Vraca true ako su tacke ponovo izracunate (tada treba osveziti VBO)
+    bool update(const RouteGeometry& route, float pixelsPerUnit);
+    void rebuild(const RouteGeometry& route, float pixelsPerUnit);
+
+    int vertexCount() const { return (int)vertices.size() / 2; }
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+
+// Opis: pakovanje pravougaonika u stranicu atlasa tekstura (skyline, donji-levi).
+// Cuva se samo gornja ivica zauzetog dela ("horizont") kao niz vodoravnih duzi; svaki novi
+// pravougaonik ide na mesto gde mu je gornja ivica najniza. Bez OpenGL-a, pa radi i u benchmarku.
+
+struct SkylineNode {
+    int x, y, width;
+};
+
+struct SkylinePacker {
+    int width, height;
+    int usedArea;
+    std::vector<SkylineNode> skyline;
+
+    SkylinePacker();
+    void init(int width, int height);
+    // Vraca false ako pravougaonik ne staje; x, y su gornji levi ugao (redovi slike idu odozgo)
+    bool insert(int rectWidth, int rectHeight, int* x, int* y);
+    float occupancy() const { return (float)usedArea / ((float)width * height); }
+
+private:
+    // Visina na kojoj bi pravougaonik lezao ako pocinje na cvoru index, -1 ako ne staje
+    int fitHeight(int index, int rectWidth, int rectHeight) const;
+    void addLevel(int index, int x, int y, int rectWidth, int rectHeight);
+};
+
+// Rezultat pakovanja vise pravougaonika u jednu ili vise stranica
+struct AtlasPlacement {
+    int page;
+    int x, y;
+};
+
+// Pakuje od najviseg ka najnizem (tako skyline ostavlja najmanje rupa); svaki pravougaonik dobija
+// "padding" piksela slobodnog prostora sa svake strane. Vraca broj stranica, 0 ako je neki veci od stranice.
+int packAtlas(const int* widths, const int* heights, int count, int pageWidth, int pageHeight, int padding,
+    AtlasPlacement* placements, std::vector<SkylinePacker>* pages = 0);
@@ -0,0 +1,5 @@
+#pragma once
+
+// Pokrece headless benchmarke (bez prozora i OpenGL konteksta).
+// Bez argumenata pokrece sve, inace samo one cija su imena navedena.
+int runBenchmarks(int argc, char** argv);
@@ -0,0 +1,24 @@
+#pragma once
+#include "Route.h"
+
+// Opis: paketno racunanje tacaka na kvadratnim Bezijeovim krivama (SSE/AVX2).
+// Kernel se bira jednom, pri prvom pozivu, prema tome sta procesor podrzava; skalarna verzija uvek postoji.
+// Sve verzije racunaju istim redosledom operacija kao bezierQuadratic, pa daju iste rezultate.
+
+enum BezierKernel {
+    BEZIER_KERNEL_SCALAR,
+    BEZIER_KERNEL_SSE,
+    BEZIER_KERNEL_AVX2
+};
+
+// Jedna kriva, "count" parametara t
+void bezierQuadraticBatch(Vec2 p0, Vec2 p1, Vec2 p2, const float* t, float* outX, float* outY, int count);
+
+// "count" tacaka, tacka i je na krivoj curveIndex[i] za parametar t[i]
+void bezierQuadraticIndexed(const BezierCurves& curves, const int* curveIndex, const float* t, float* outX, float* outY, int count);
+
+BezierKernel bezierBestKernel();
+BezierKernel bezierActiveKernel();
+// Za benchmarke: rucno biranje kernela, vraca false ako procesor ne podrzava trazeni
+bool bezierSetKernel(BezierKernel kernel);
+const char* bezierKernelName(BezierKernel kernel);
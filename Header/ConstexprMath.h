@@ -0,0 +1,42 @@
+#pragma once
+
+// Opis: sin, cos i sqrt koje kompajler moze da izracuna (constexpr, C++14 pravila).
+// Za podatke koji se racunaju pri prevodjenju (KioskRoute.h); u toku rada se koriste funkcije iz <cmath>.
+// Racunaju u double, pa su posle zaokruzivanja na float u okviru jednog ulp-a od <cmath> verzija.
+
+constexpr double CONSTEXPR_PI = 3.14159265358979323846;
+
+constexpr double constexprSin(double x) {
+    // Svodjenje na [-pi, pi], pa Tejlorov red; 12 clanova je dovoljno za double tacnost na tom intervalu
+    while (x > CONSTEXPR_PI) x -= 2.0 * CONSTEXPR_PI;
+    while (x < -CONSTEXPR_PI) x += 2.0 * CONSTEXPR_PI;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double constexprCos(double x) {
+    return constexprSin(x + CONSTEXPR_PI / 2.0);
+}
+
+constexpr double constexprSqrt(double x) {
+    if (x <= 0.0) {
+        return 0.0;
+    }
+    // Pocetak je stepen dvojke >= sqrt(x), pa Njutnova metoda monotono opada dok se ne zaustavi
+    double r = 1.0;
+    while (r * r < x) r *= 2.0;
+    while (r * r > 4.0 * x) r *= 0.5;
+    for (int i = 0; i < 64; i++) {
+        double next = 0.5 * (r + x / r);
+        if (next >= r) {
+            break;
+        }
+        r = next;
+    }
+    return r;
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <tuple>
+#include <utility>
+#include "Route.h"
+
+// Opis: Bezijeove krive sa stepenom i brojem duzi za teselaciju kao parametrima sablona.
+// Racunanje tacke je razvijeno pri prevodjenju (bez petlji po stepenu), a opsezi za glDrawArrays
+// slede iz tipova, pa ruta sa mesovitim krivama nema virtuelne pozive ni "magicne" brojeve tacaka.
+// Kvadratna kriva racuna istim redosledom operacija kao bezierQuadratic, pa daje iste tacke.
+
+struct DrawRange {
+    int first;
+    int count;
+};
+
+// ========== POMOCNI SABLONI ==========
+template <int N, int K>
+struct Binomial {
+    static constexpr int value = Binomial<N - 1, K - 1>::value + Binomial<N - 1, K>::value;
+};
+template <int N>
+struct Binomial<N, 0> {
+    static constexpr int value = 1;
+};
+template <int N>
+struct Binomial<N, N> {
+    static constexpr int value = 1;
+};
+template <>
+struct Binomial<0, 0> {
+    static constexpr int value = 1;
+};
+
+// w * x * x * ... (K puta), levo asocijativno kao u rucno pisanim formulama
+template <int K>
+struct MultiplyTimes {
+    static constexpr float apply(float w, float x) { return MultiplyTimes<K - 1>::apply(w * x, x); }
+};
+template <>
+struct MultiplyTimes<0> {
+    static constexpr float apply(float w, float) { return w; }
+};
+
+// Bernstajnov clan I za krivu stepena N, pa rekurzivno sledeci
+template <int N, int I>
+struct BernsteinSum {
+    static constexpr Vec2 apply(const Vec2* p, float u, float t, Vec2 sum) {
+        return BernsteinSum<N, I + 1>::apply(p, u, t, Vec2(sum.x + weight(u, t) * p[I].x, sum.y + weight(u, t) * p[I].y));
+    }
+    static constexpr float weight(float u, float t) {
+        return MultiplyTimes<I>::apply(MultiplyTimes<N - I>::apply((float)Binomial<N, I>::value, u), t);
+    }
+};
+template <int N>
+struct BernsteinSum<N, N> {
+    static constexpr Vec2 apply(const Vec2* p, float /*u*/, float t, Vec2 sum) {
+        float w = MultiplyTimes<N>::apply(1.0f, t);
+        return Vec2(sum.x + w * p[N].x, sum.y + w * p[N].y);
+    }
+};
+
+// ========== KRIVA ==========
+template <int Degree, int Segments>
+struct Curve {
+    static_assert(Degree >= 1 && Degree <= 3, "podrzane su linearne, kvadratne i kubne krive");
+    static_assert(Segments >= 1, "kriva mora da ima bar jednu duz");
+
+    static constexpr int DEGREE = Degree;
+    static constexpr int SEGMENTS = Segments;
+    static constexpr int VERTICES = Segments + 1;   // tacaka za GL_LINE_STRIP
+    static constexpr int FLOATS = VERTICES * 2;
+
+    Vec2 points[Degree + 1];
+
+    constexpr Vec2 evaluate(float t) const {
+        // Prvi clan se ne sabira sa nulom, da bi redosled bio isti kao u bezierQuadratic
+        return BernsteinSum<Degree, 1>::apply(points, 1.0f - t, t, first(1.0f - t));
+    }
+
+    // x, y za VERTICES tacaka na jednakim razmacima parametra t
+    constexpr void tessellate(float* out) const {
+        for (int j = 0; j < VERTICES; j++) {
+            Vec2 point = evaluate((float)j / (float)Segments);
+            out[j * 2] = point.x;
+            out[j * 2 + 1] = point.y;
+        }
+    }
+
+    // Opseg i-te krive kad su sve krive rute ovog tipa, jedna za drugom u istom VBO-u
+    static constexpr DrawRange drawRange(int index) {
+        return DrawRange{ index * VERTICES, VERTICES };
+    }
+
+private:
+    constexpr Vec2 first(float u) const {
+        float w = MultiplyTimes<Degree>::apply(1.0f, u);
+        return Vec2(w * points[0].x, w * points[0].y);
+    }
+};
+
+template <int Segments> using LinearCurve = Curve<1, Segments>;
+template <int Segments> using QuadraticCurve = Curve<2, Segments>;
+template <int Segments> using CubicCurve = Curve<3, Segments>;
+
+// Segmenti rute izmedju stanica (RouteGeometry) su kvadratne krive sa ovoliko duzi u VBO-u putanje
+const int ROUTE_CURVE_SEGMENTS = 30;
+typedef QuadraticCurve<ROUTE_CURVE_SEGMENTS> RouteCurve;
+
+// ========== MESOVITA RUTA ==========
+// Krive razlicitih tipova u jednoj torki; sve petlje po krivama se razvijaju pri prevodjenju
+template <typename... Curves>
+struct CurveRoute {
+    static constexpr int CURVE_COUNT = sizeof...(Curves);
+
+    std::tuple<Curves...> curves;
+
+    static constexpr int totalVertices() {
+        int total = 0;
+        int counts[] = { Curves::VERTICES... };
+        for (int i = 0; i < CURVE_COUNT; i++) total += counts[i];
+        return total;
+    }
+
+    static constexpr int TOTAL_VERTICES = totalVertices();
+    static constexpr int TOTAL_FLOATS = TOTAL_VERTICES * 2;
+
+    static constexpr DrawRange drawRange(int index) {
+        int counts[] = { Curves::VERTICES... };
+        int first = 0;
+        for (int i = 0; i < index; i++) first += counts[i];
+        return DrawRange{ first, counts[index] };
+    }
+
+    template <int I>
+    constexpr const typename std::tuple_element<I, std::tuple<Curves...> >::type& curve() const {
+        return std::get<I>(curves);
+    }
+
+    // Sve krive u jedan niz od TOTAL_FLOATS, redom; opsezi su drawRange(i)
+    void tessellate(float* out) const {
+        tessellateFrom(out, std::index_sequence_for<Curves...>());
+    }
+
+private:
+    template <std::size_t... I>
+    void tessellateFrom(float* out, std::index_sequence<I...>) const {
+        int dummy[] = { 0, (std::get<I>(curves).tessellate(out + drawRange((int)I).first * 2), 0)... };
+        (void)dummy;
+    }
+};
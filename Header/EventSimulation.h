@@ -0,0 +1,49 @@
+#pragma once
+#include <queue>
+#include <vector>
+
+// Opis: simulacija vodjena dogadjajima, za offline analize.
+// Izmedju polaska i dolaska nema nicega zanimljivog, pa se vreme ne integrise po frejmovima
+// nego se skace direktno na sledeci dogadjaj iz prioritetnog reda.
+// Vremena su tacna (bez zaokruzivanja na tik od SIMULATION_DT kao u Simulation).
+
+enum BusEventType {
+    BUS_EVENT_DEPARTURE,
+    BUS_EVENT_ARRIVAL
+};
+
+struct BusEvent {
+    double time;
+    int bus;
+    int station;
+    BusEventType type;
+
+    // Za min-heap: raniji dogadjaj ima prednost, pri istom vremenu manji broj autobusa
+    bool operator>(const BusEvent& other) const {
+        if (time != other.time) return time > other.time;
+        return bus > other.bus;
+    }
+};
+
+struct EventSimulationStats {
+    long long departures;
+    long long arrivals;
+    std::vector<long long> arrivalsPerStation;
+};
+
+struct EventSimulation {
+    std::priority_queue<BusEvent, std::vector<BusEvent>, std::greater<BusEvent> > queue;
+    std::vector<int> busStation;
+    double now;
+    EventSimulationStats stats;
+
+    EventSimulation();
+    void reset();
+
+    // Autobus ceka na stanici "station" i polazi u trenutku departureTime
+    int addBus(int station, double departureTime);
+
+    // Obradjuje sledeci dogadjaj ako nije posle endTime; vraca false kad takvog nema
+    bool processNext(double endTime, BusEvent* processed = 0);
+    void runUntil(double endTime);
+};
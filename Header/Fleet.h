@@ -0,0 +1,32 @@
+#pragma once
+#include <vector>
+
+struct RouteGeometry;
+
+// Opis: vise autobusa na istoj ruti, stanje je rasporedjeno po nizovima (structure of arrays).
+// Svaki niz je kontinualan, pa je petlja u step() kratka, bez grananja i moze da se vektorizuje.
+
+enum FleetFlag {
+    FLEET_AT_STATION = 1 << 0
+};
+
+struct Fleet {
+    std::vector<float> progress;
+    std::vector<float> stationTimer;
+    std::vector<int> segment;
+    std::vector<unsigned int> flags; // 32-bitni kao i ostali nizovi, da sve trake vektora budu iste sirine
+
+    int size() const { return (int)progress.size(); }
+    void clear();
+    void reserve(int count);
+
+    // Dodaje autobus na stanici "station"; stationTimer pomera polazak (za rasporedjivanje flote)
+    int addBus(int station, float stationTimer = 0.0f);
+
+    // Pomeranje svih autobusa za dt, vraca broj dolazaka na stanice u ovom koraku
+    int step(float dt);
+
+    // Pozicije svih autobusa na ruti: t iz tabela duzine luka, tacke paketnim Bezijeovim kernelom.
+    // params je pomocni niz od size() elemenata koji daje pozivalac, pa istovremeni upiti ne dele stanje
+    void computePositions(const RouteGeometry& route, float* params, float* outX, float* outY) const;
+};
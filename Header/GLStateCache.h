@@ -0,0 +1,86 @@
+#pragma once
+#include <vector>
+
+// Opis: tanak sloj ispred OpenGL poziva koji menjaju stanje (program, VAO, teksture i sampleri, blending, uniforme).
+// Pamti poslednju postavljenu vrednost i preskace poziv ako se nista ne menja, a broji izvrsene i
+// preskocene pozive po vrsti. Kod koji zaobidje kes (npr. ucitavanje tekstura) posle toga zove invalidate().
+
+enum GLStateCall {
+    GL_CALL_PROGRAM,
+    GL_CALL_VERTEX_ARRAY,
+    GL_CALL_ACTIVE_TEXTURE,
+    GL_CALL_TEXTURE,
+    GL_CALL_SAMPLER,
+    GL_CALL_CAPABILITY,
+    GL_CALL_BLEND_FUNC,
+    GL_CALL_UNIFORM,
+    GL_CALL_KIND_COUNT
+};
+
+const int GL_CACHE_TEXTURE_UNITS = 8;
+// Vrednost koju GL ne moze da vrati; posle invalidate() prvi poziv svake vrste ide do drajvera
+const unsigned int GL_STATE_UNKNOWN = 0xFFFFFFFFu;
+
+struct GLStateStats {
+    unsigned long long issued[GL_CALL_KIND_COUNT];
+    unsigned long long elided[GL_CALL_KIND_COUNT];
+};
+
+struct GLStateCache {
+    // Vrednosti uniformi po programu, indeksirane lokacijom; do 16 reci (mat4)
+    struct UniformSlot {
+        bool valid;
+        int words;
+        unsigned int bits[16];
+    };
+    struct ProgramUniforms {
+        unsigned int program;
+        std::vector<UniformSlot> slots;
+    };
+
+    unsigned int program;
+    unsigned int vertexArray;
+    unsigned int activeUnit;
+    unsigned int textures[GL_CACHE_TEXTURE_UNITS];
+    unsigned int samplers[GL_CACHE_TEXTURE_UNITS];
+    // Sposobnosti koje program menja (GL_BLEND, GL_PRIMITIVE_RESTART): 0 iskljuceno, 1 ukljuceno
+    unsigned int capabilities[2];
+    unsigned int capabilityState[2];
+    unsigned int blendSource, blendDestination;
+    std::vector<ProgramUniforms> uniforms;
+    ProgramUniforms* currentUniforms;
+    GLStateStats stats;
+
+    GLStateCache();
+    // Sve sledece promene idu do drajvera; uniforme programa ostaju zapamcene jer ih menja samo glUniform*
+    void invalidate();
+    void resetStats();
+    // Pre glDeleteProgram, da novi program sa istim id-jem ne nasledi vrednosti
+    void forgetProgram(unsigned int id);
+
+    void useProgram(unsigned int id);
+    void bindVertexArray(unsigned int id);
+    // Uz teksturu vezuje i sampler objekat preseta zapamcenog pri njenom ucitavanju (Samplers.h)
+    void bindTexture(int unit, unsigned int texture);
+    void setEnabled(unsigned int capability, bool enabled);
+    void blendFunc(unsigned int source, unsigned int destination);
+
+    // Za trenutno aktivan program; lokacija -1 se preskace bez brojanja
+    void uniform(int location, int value);
+    void uniform(int location, float value);
+    void uniform(int location, float x, float y, float z);
+    void uniformMatrix(int location, const float* matrix4);
+
+    unsigned long long totalIssued() const;
+    unsigned long long totalElided() const;
+    void printStats(unsigned long long frames) const;
+
+private:
+    void activeTexture(int unit);
+    void bindSampler(int unit, unsigned int sampler);
+    bool uniformChanged(int location, const void* data, int words);
+    bool record(GLStateCall call, bool changed);
+};
+
+// Jedan kontekst, jedan kes; koristi ga samo nit prikaza
+extern GLStateCache glState;
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Simulation.h"
+
+// Opis: kompaktan dnevnik ulaza za deterministicko ponavljanje sesije.
+// Posto su slucajni brojevi odredjeni seed-om (Random.h), dovoljno je zapisati seed i ulaze sa tikom simulacije.
+// Zapis je varint((razlika tikova << 2) | vrsta), obicno 1-3 bajta po dogadjaju.
+// Na kraju je oznaka kraja sa poslednjim tikom i konacno stanje, da replay moze da proveri da se poklapa.
+
+const uint32_t JOURNAL_MAGIC = 0x4A535542u;   // "BUSJ"
+const uint32_t JOURNAL_VERSION = 1;
+const int JOURNAL_END = 3;                    // vrsta zapisa posle INPUT_* vrednosti
+
+struct InputJournal {
+    uint64_t seed;
+    uint32_t bus;
+    std::vector<unsigned char> bytes;
+    uint64_t lastTick;
+    uint64_t eventCount;
+    bool finished;
+    int32_t finalPassengers;
+    int32_t finalTotalFines;
+
+    InputJournal();
+    void begin(uint64_t seed, uint32_t bus);
+    void record(uint64_t tick, SimulationInput input);
+    void finish(const SimulationState& state);
+
+    bool save(const char* path) const;
+    bool load(const char* path);
+};
+
+struct ReplayResult {
+    uint64_t ticks;
+    uint64_t events;
+    double seconds;
+    bool matches;
+    SimulationState finalState;
+};
+
+ReplayResult replayJournal(const InputJournal& journal);
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "Simulation.h"
+
+// Opis: ograniceni lock-free red ulaza (jedan proizvodjac, jedan potrosac).
+// GLFW callback-ovi upisuju dogadjaje sa vremenom, a simulacija ih preuzima u paketima jednom po frejmu,
+// pa se vise klikova u istom frejmu ne stapa u jedan i nijedan ulaz se ne gubi.
+// Proizvodjac pise samo head, potrosac samo tail; svaki je na svojoj liniji kesa.
+
+// Prve tri komande su iste kao SimulationInput, ostale su komande prikaza
+enum InputCommand {
+    COMMAND_ADD_PASSENGER = INPUT_ADD_PASSENGER,
+    COMMAND_REMOVE_PASSENGER = INPUT_REMOVE_PASSENGER,
+    COMMAND_SEND_INSPECTOR = INPUT_SEND_INSPECTOR,
+    COMMAND_SAVE_SNAPSHOT,
+    COMMAND_LOAD_SNAPSHOT,
+    COMMAND_WARP_FASTER,
+    COMMAND_WARP_SLOWER
+};
+
+struct InputEvent {
+    double time;        // glfwGetTime() u trenutku callback-a
+    uint32_t command;   // InputCommand
+};
+
+const uint32_t INPUT_QUEUE_CAPACITY = 1024;   // stepen dvojke
+
+inline bool isSimulationCommand(uint32_t command) {
+    return command <= COMMAND_SEND_INSPECTOR;
+}
+
+struct InputQueue {
+    alignas(64) std::atomic<uint32_t> head;   // sledece mesto za upis (proizvodjac)
+    alignas(64) std::atomic<uint32_t> tail;   // sledece mesto za citanje (potrosac)
+    alignas(64) uint32_t dropped;             // ulazi odbaceni jer je red bio pun (samo proizvodjac)
+    InputEvent events[INPUT_QUEUE_CAPACITY];
+
+    InputQueue();
+    // Proizvodjac; vraca false ako je red pun
+    bool push(double time, InputCommand command);
+    // Potrosac; preuzima najvise maxCount dogadjaja redom kojim su upisani
+    uint32_t drain(InputEvent* out, uint32_t maxCount);
+};
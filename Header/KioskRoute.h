@@ -0,0 +1,15 @@
+#pragma once
+#include "Route.h"
+#include "Simulation.h"
+
+// Opis: fiksna ruta za kioske, izracunata pri prevodjenju (constexpr).
+// Stanice i kontrolne tacke su staticki nizovi u izvrsnom fajlu; putanju tesselira AdaptivePath za razmeru ekrana.
+// Tabele duzine luka se i dalje prave pri pokretanju (RouteGeometry::build), jer su za prevodjenje
+// preskupe; one su skoro celo vreme pokretanja rute, pa constexpr podaci ne skracuju pokretanje merljivo.
+
+struct KioskRouteData {
+    Station stations[NUM_STATIONS];
+    Vec2 controlPoints[NUM_STATIONS];
+};
+
+const KioskRouteData& kioskRoute();
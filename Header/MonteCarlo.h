@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Opis: Monte Karlo procena prihoda od kazni, po istom modelu kao dolazak kontrole u Simulation:
+// kontrola zatekne K putnika i naplati uniformno 0..K kazni.
+// Svaka voznja i ima svoj Philox blok (seed, i), pa rezultat ne zavisi od broja niti;
+// sume su celobrojne, pa je i spajanje rezultata niti tacno.
+
+enum VarianceReduction {
+    VARIANCE_REDUCTION_NONE = 0,
+    // Parovi voznji sa ogledalnim uniformnim brojevima (u i 1 - u) za opterecenje i kaznu
+    VARIANCE_REDUCTION_ANTITHETIC = 1 << 0,
+    // K kao kontrolna promenljiva (E[K] je poznato iz raspodele opterecenja); ne kombinuje se sa parovima
+    VARIANCE_REDUCTION_CONTROL_VARIATE = 1 << 1
+};
+
+struct MonteCarloConfig {
+    uint64_t seed;
+    long long trips;
+    int minLoad;
+    int maxLoad;
+    int threads;              // 0 = koliko ima jezgara
+    unsigned varianceReduction;
+    long long tripsPerDay;    // za raspodelu ukupnih kazni u jednom danu
+
+    MonteCarloConfig();
+};
+
+struct MonteCarloResult {
+    long long trips;
+    double mean;              // procena ocekivanih kazni po voznji (sa smanjenjem varijanse)
+    double variance;          // varijansa kazni po voznji
+    double standardError;     // standardna greska procene "mean"
+    int quantiles[5];         // 5%, 25%, 50%, 75%, 95% kazni po voznji
+    double dayMean;           // totalFines za tripsPerDay voznji
+    double dayStdDev;
+    std::vector<long long> histogram;
+    double seconds;
+    int threads;
+    unsigned varianceReduction;   // rezimi koji su stvarno primenjeni
+};
+
+extern const double MONTE_CARLO_QUANTILES[5];
+
+MonteCarloResult estimateFines(const MonteCarloConfig& config);
+void printMonteCarloResult(const MonteCarloConfig& config, const MonteCarloResult& result);
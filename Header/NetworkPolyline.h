@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+struct AdaptivePath;
+
+// Opis: sve linije mreze u jednom baferu, za crtanje jednim glDrawElements(GL_LINE_STRIP).
+// Linije su u indeksima razdvojene indeksom za prekid (primitive restart), a svako teme nosi
+// redni broj linije koji u sejderu bira boju iz palete. Bez OpenGL poziva (crta NetworkRenderer).
+
+const uint32_t NETWORK_RESTART_INDEX = 0xFFFFFFFFu;
+
+// Linija je niz uzastopnih segmenata rute; zatvorena se vraca na pocetnu stanicu
+struct NetworkLine {
+    int firstSegment;
+    int segmentCount;
+    bool closed;
+};
+
+struct NetworkVertex {
+    float x, y;
+    uint32_t line;
+};
+
+struct NetworkPolyline {
+    std::vector<NetworkVertex> vertices;
+    std::vector<uint32_t> indices;
+
+    // Kraj segmenta je pocetak sledeceg, pa se zajednicka tacka upisuje jednom
+    void build(const AdaptivePath& path, const NetworkLine* lines, int lineCount);
+    int indexCount() const { return (int)indices.size(); }
+};
@@ -0,0 +1,23 @@
+#pragma once
+#include "NetworkPolyline.h"
+#include "ShaderProgram.h"
+
+// Opis: crta NetworkPolyline jednim pozivom; boja linije je teksel palete (tekstura sirine
+// NETWORK_PALETTE_SIZE, visine 1) na mestu rednog broja linije, po modulu velicine palete.
+
+const int NETWORK_PALETTE_SIZE = 8;
+
+struct NetworkRenderer {
+    ShaderProgram shader;
+    unsigned int vao, vbo, ebo;
+    unsigned int paletteTexture;
+    int indexCount;
+
+    NetworkRenderer();
+    // palette: NETWORK_PALETTE_SIZE boja, po tri float vrednosti (r, g, b)
+    bool init(const char* vertexPath, const char* fragmentPath, const float* palette);
+    void destroy();
+
+    void upload(const NetworkPolyline& polyline);
+    void draw() const;
+};
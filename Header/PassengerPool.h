@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Opis: pojedinacni putnici (agenti) u areni po ruti.
+// Putnici se alociraju u komadima od PASSENGER_CHUNK_SIZE i nikad ne vracaju sistemu:
+// oslobodjeni ulaze u listu slobodnih i ponovo se koriste, pa ukrcavanje/iskrcavanje ne dira heap.
+// Putnik se referise indeksom (ne pokazivacem), pa indeksi ostaju vazeci kad arena poraste.
+
+enum FareStatus {
+    FARE_UNCHECKED,
+    FARE_PAID,
+    FARE_FINED
+};
+
+const uint32_t PASSENGER_NONE = 0xFFFFFFFFu;
+const int PASSENGER_CHUNK_BITS = 12;
+const uint32_t PASSENGER_CHUNK_SIZE = 1u << PASSENGER_CHUNK_BITS;
+
+struct Passenger {
+    int16_t boardingStation;
+    int16_t alightingStation;   // -1 dok je putnik u autobusu, posle izlaska ceka u listi zavrsenih voznji
+    uint8_t fareStatus;
+    uint32_t next;              // sledeci u listi (putnici u autobusu ili slobodna mesta)
+};
+
+struct PassengerPool {
+    std::vector<std::unique_ptr<Passenger[]> > chunks;
+    uint32_t freeHead;
+    // Putnici koji su izasli; zapis se cuva dok ga drainCompleted ne obradi i vrati u listu slobodnih
+    uint32_t completedHead;
+    uint32_t capacity;
+    uint32_t live;
+    long long chunkAllocations;
+
+    PassengerPool();
+    void reserve(uint32_t count);
+
+    uint32_t allocate(int boardingStation);
+    void release(uint32_t index);
+    void complete(uint32_t index, int alightingStation);
+
+    // Poziva visit(const Passenger&) za svaku zavrsenu voznju i oslobadja zapise; vraca broj obradjenih
+    template <typename Visit>
+    uint32_t drainCompleted(Visit visit) {
+        uint32_t drained = 0;
+        while (completedHead != PASSENGER_NONE) {
+            uint32_t index = completedHead;
+            completedHead = (*this)[index].next;
+            visit((const Passenger&)(*this)[index]);
+            release(index);
+            drained++;
+        }
+        return drained;
+    }
+
+    Passenger& operator[](uint32_t index) { return chunks[index >> PASSENGER_CHUNK_BITS][index & (PASSENGER_CHUNK_SIZE - 1)]; }
+    const Passenger& operator[](uint32_t index) const { return chunks[index >> PASSENGER_CHUNK_BITS][index & (PASSENGER_CHUNK_SIZE - 1)]; }
+
+private:
+    void addChunk();
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Opis: brojacki generator slucajnih brojeva (Philox4x32-10).
+// Nema globalnog stanja: broj zavisi samo od kljuca (seed) i brojaca (autobus, dogadjaj),
+// pa vise niti dobija iste rezultate bez obzira na redosled izvrsavanja.
+
+// ========== PHILOX4x32-10 ==========
+const uint32_t PHILOX_M0 = 0xD2511F53u;
+const uint32_t PHILOX_M1 = 0xCD9E8D57u;
+const uint32_t PHILOX_W0 = 0x9E3779B9u;
+const uint32_t PHILOX_W1 = 0xBB67AE85u;
+
+inline void philox4x32(const uint32_t counter[4], uint32_t key0, uint32_t key1, uint32_t out[4]) {
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    for (int round = 0; round < 10; round++) {
+        uint64_t product0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t product1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t hi0 = (uint32_t)(product0 >> 32), lo0 = (uint32_t)product0;
+        uint32_t hi1 = (uint32_t)(product1 >> 32), lo1 = (uint32_t)product1;
+        c0 = hi1 ^ c1 ^ key0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ key1;
+        c3 = lo0;
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// ========== POJEDINACNI BROJEVI ==========
+// Kljuc je seed, brojac je (autobus, dogadjaj); "lane" bira jednu od 4 reci istog bloka
+inline uint32_t randomBits(uint64_t seed, uint32_t bus, uint32_t event, int lane = 0) {
+    uint32_t counter[4] = { event, bus, 0, 0 };
+    uint32_t out[4];
+    philox4x32(counter, (uint32_t)seed, (uint32_t)(seed >> 32), out);
+    return out[lane & 3];
+}
+
+// Uniformno u [0, 1), 24 bita preciznosti
+inline float randomUniform(uint64_t seed, uint32_t bus, uint32_t event) {
+    return (randomBits(seed, bus, event) >> 8) * (1.0f / 16777216.0f);
+}
+
+// Uniformno u [0, range); mnozenje i pomeranje umesto % (nema pristrasnosti ka malim brojevima kao rand() % n)
+inline int randomInt(uint64_t seed, uint32_t bus, uint32_t event, int range) {
+    return (int)(((uint64_t)randomBits(seed, bus, event) * (uint32_t)range) >> 32);
+}
+
+// ========== PAKETNO ==========
+// Popunjava "count" reci iz uzastopnih blokova toka "stream", pocevsi od bloka firstBlock.
+// Reci iz bloka b su isti brojevi koje vraca randomBits(seed, stream, b, 0..3).
+void randomFillBits(uint64_t seed, uint32_t stream, uint32_t firstBlock, uint32_t* out, size_t count);
+void randomFillUniform(uint64_t seed, uint32_t stream, uint32_t firstBlock, float* out, size_t count);
@@ -0,0 +1,80 @@
+#pragma once
+#include <vector>
+
+// Opis: geometrija rute - tacke, stanice, Bezijeove krive izmedju stanica
+// i tabele duzine luka za kretanje konstantnom brzinom.
+
+// ========== STRUKTURE ==========
+struct Vec2 {
+    float x, y;
+    constexpr Vec2(float x = 0, float y = 0) : x(x), y(y) {}
+};
+
+struct Station {
+    Vec2 position;
+    int number;
+};
+
+// ========== KRIVE ==========
+Vec2 lerp(Vec2 a, Vec2 b, float t);
+Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t);
+
+// Kontrolna tacka krive od stanice "segment" (p0) do sledece stanice (p2)
+Vec2 segmentControlPoint(Vec2 p0, Vec2 p2, int segment);
+
+// ========== TABELA DUZINE LUKA ==========
+const int ARC_TABLE_SAMPLES = 64;
+
+// Krivu uzorkuje na jednakim razmacima po duzini luka (ne po parametru t),
+// pa je upit za poziciju na predjenoj duzini O(1): indeks + linearna interpolacija.
+struct ArcLengthTable {
+    float length;
+    float params[ARC_TABLE_SAMPLES + 1];
+    Vec2 positions[ARC_TABLE_SAMPLES + 1];
+
+    void build(Vec2 p0, Vec2 p1, Vec2 p2);
+
+    // "fraction" je udeo predjene duzine luka, od 0 do 1
+    Vec2 positionAtFraction(float fraction) const;
+    float parameterAtFraction(float fraction) const;
+    Vec2 positionAt(float distance) const { return positionAtFraction(length > 0.0f ? distance / length : 0.0f); }
+};
+
+// Kontrolne tacke vise krivih, svaka koordinata u svom nizu (za paketne kernele iz BezierBatch.h)
+struct BezierCurves {
+    std::vector<float> p0x, p0y, p1x, p1y, p2x, p2y;
+
+    void clear();
+    void add(Vec2 p0, Vec2 p1, Vec2 p2);
+    int size() const { return (int)p0x.size(); }
+};
+
+// ========== GEOMETRIJA RUTE ==========
+struct RouteSegment {
+    Vec2 p0, p1, p2;
+    float length;
+    Vec2 boundsMin, boundsMax;
+    ArcLengthTable table;
+};
+
+// Kontrolne tacke, duzine i okviri segmenata se racunaju jednom i cuvaju.
+// Kad se stanica pomeri, ponovo se racunaju samo dva segmenta koja je dodiruju (u update()).
+struct RouteGeometry {
+    std::vector<Vec2> stationPositions;
+    std::vector<RouteSegment> segments;
+    std::vector<bool> dirty;
+    BezierCurves curves;
+    unsigned int version;
+
+    RouteGeometry() : version(0) {}
+
+    void build(const Station* stations, int count);
+    // Kontrolne tacke su vec izracunate (npr. KioskRoute.h), pa se ne racunaju ponovo
+    void build(const Station* stations, const Vec2* controlPoints, int count);
+    void moveStation(int index, Vec2 position);
+
+    // Vraca true ako je nesto preracunato (tada treba osveziti i VBO putanje)
+    bool update();
+
+    int segmentCount() const { return (int)segments.size(); }
+};
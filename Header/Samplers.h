@@ -0,0 +1,31 @@
+#pragma once
+
+// Opis: imenovani nacini uzorkovanja tekstura (filtriranje i ponavljanje).
+// Za svaki postoji jedan sampler objekat, napravljen pri pokretanju. Preset se bira pri ucitavanju teksture
+// i pamti uz nju; glState.bindTexture uz teksturu vezuje i njen sampler, pa crtanje ne postavlja parametre
+// tekstura. Isti parametri se upisuju i u samu teksturu, da bi bila ispravna i kad sampler nije napravljen.
+
+enum SamplerPreset {
+    SAMPLER_LINEAR_CLAMP,       // sprajtovi i atlas
+    SAMPLER_NEAREST_CLAMP,      // tabele koje se citaju po tekselu (paleta linija)
+    SAMPLER_LINEAR_REPEAT,      // teksture koje se ponavljaju po povrsini
+    SAMPLER_TRILINEAR_CLAMP,    // umanjene slike; tekstura dobija mipmape pri ucitavanju
+    SAMPLER_PRESET_COUNT
+};
+
+// Jedinice tekstura koje koriste programi
+const int TEXTURE_UNIT_SPRITES = 0;
+const int TEXTURE_UNIT_PALETTE = 1;
+
+bool samplerUsesMipmaps(SamplerPreset preset);
+// Upisuje parametre preseta u teksturu vezanu za GL_TEXTURE_2D i pamti preset za nju (jednom, pri ucitavanju)
+void applySamplerToTexture(unsigned int texture, SamplerPreset preset);
+// Preset zapamcen pri ucitavanju; tekstura bez njega (i 0) koristi SAMPLER_LINEAR_CLAMP
+SamplerPreset textureSampler(unsigned int texture);
+// Pre glDeleteTextures, da nova tekstura sa istim imenom ne nasledi preset
+void forgetTextureSampler(unsigned int texture);
+
+void createSamplers();
+void destroySamplers();
+// Sampler objekat preseta; 0 pre createSamplers, pa vaze parametri teksture
+unsigned int samplerObject(SamplerPreset preset);
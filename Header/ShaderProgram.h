@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// Opis: omotac oko createShader koji sve uniforme pronadje jednom, posle linkovanja.
+// Crtanje koristi samo sacuvane lokacije i tipizirane setere, pa u frejmu nema trazenja po imenu.
+// Podaci zajednicki za ceo frejm (matrica pogleda, vreme) idu u uniform buffer (FrameData).
+
+// Tacka vezivanja FrameData bloka, ista za sve programe
+const unsigned int FRAME_DATA_BINDING = 0;
+
+// Raspored po std140: mat4 pa vec4, bez dopunjavanja
+struct FrameData {
+    float view[16];
+    float time;
+    float aspect;
+    float padding[2];
+};
+
+struct ShaderProgram {
+    unsigned int id;
+    // Sve aktivne uniforme programa, procitane jednom pri ucitavanju
+    std::vector<std::string> uniformNames;
+    std::vector<int> uniformLocations;
+
+    ShaderProgram();
+    bool load(const char* vertexPath, const char* fragmentPath);
+    void destroy();
+
+    // Samo pri inicijalizaciji; -1 ako uniforma ne postoji (ili ju je kompajler izbacio)
+    int uniform(const char* name) const;
+    // Vezuje uniform blok za tacku vezivanja; false ako program nema taj blok
+    bool bindBlock(const char* blockName, unsigned int binding) const;
+
+    void use() const;
+
+    // Tipizirani seteri za trenutno aktivan program (kroz GLStateCache); lokacija -1 se tiho preskace kao u OpenGL-u
+    static void set(int location, int value);
+    static void set(int location, float value);
+    static void set(int location, float x, float y, float z);
+    static void setMatrix(int location, const float* matrix4);
+};
+
+struct UniformBuffer {
+    unsigned int id;
+    unsigned int size;
+
+    UniformBuffer();
+    void create(unsigned int size, unsigned int binding);
+    void update(const void* data, unsigned int size);
+    void destroy();
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+
+// Opis: logika autobusa bez prozora i OpenGL konteksta.
+// Simulacija se pomera fiksnim korakom pozivom step(dt), pa moze da radi i headless (benchmark, batch).
+
+// ========== KONSTANTE ==========
+const int NUM_STATIONS = 10;
+const float BUS_SPEED = 0.15f;
+const float STATION_WAIT_TIME = 10.0f;
+const int MAX_PASSENGERS = 50;
+const float SIMULATION_DT = 1.0f / 75.0f;
+
+// ========== ULAZI I DOGADJAJI ==========
+enum SimulationInput {
+    INPUT_ADD_PASSENGER,
+    INPUT_REMOVE_PASSENGER,
+    INPUT_SEND_INSPECTOR
+};
+
+// Bit maska koju vracaju handleInput i step, da bi prikaz mogao da ispise poruke
+enum SimulationEvent {
+    EVENT_NONE = 0,
+    EVENT_PASSENGER_ENTERED = 1 << 0,
+    EVENT_PASSENGER_LEFT = 1 << 1,
+    EVENT_INSPECTOR_ENTERED = 1 << 2,
+    EVENT_INSPECTOR_REJECTED = 1 << 3,
+    EVENT_BUS_DEPARTED = 1 << 4,
+    EVENT_BUS_ARRIVED = 1 << 5,
+    EVENT_INSPECTOR_LEFT = 1 << 6
+};
+
+// ========== STANJE ==========
+struct SimulationState {
+    int currentStation;
+    int nextStation;
+    float busProgress;
+    bool busAtStation;
+    float stationTimer;
+    int passengers;
+    bool isInspectorInBus;
+    int totalFines;
+    int inspectorExitStation;
+    int lastFines;
+
+    // Slucajni brojevi su odredjeni sa (seed, bus, rngEvent), vidi Random.h
+    uint64_t seed;
+    uint32_t bus;
+    uint32_t rngEvent;
+
+    // Broj izvrsenih step() poziva; vreme za dnevnik ulaza (InputJournal)
+    uint64_t tick;
+
+    // Zavrsene voznje sa poznatom stanicom ukrcavanja (samo uz PassengerPool), preuzete pri svakom polasku
+    uint32_t completedTrips;
+    uint32_t tripStations;   // zbir predjenih stanica, za prosecnu duzinu voznje
+
+    // Prvi putnik u autobusu (lista kroz PassengerPool), PASSENGER_NONE ako nema pool-a ili putnika
+    uint32_t onboardHead;
+};
+
+struct PassengerPool;
+
+struct Simulation {
+    SimulationState state;
+    // Opciono: bez pool-a se vodi samo broj putnika
+    PassengerPool* passengerPool;
+
+    Simulation(uint64_t seed = 0, uint32_t bus = 0);
+    void reset(uint64_t seed = 0, uint32_t bus = 0);
+    void attachPassengerPool(PassengerPool* pool);
+    unsigned handleInput(SimulationInput input);
+    unsigned step(float dt);
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include "Simulation.h"
+#include "TimeWarp.h"
+#include "InputQueue.h"
+#include "InputJournal.h"
+#include "TripleBuffer.h"
+
+// Opis: simulacija na sopstvenoj niti, fiksnom ucestaloscu nezavisnom od prikaza.
+// Nit preuzima ulaze iz InputQueue, pomera simulaciju (sa ubrzanjem, TimeWarp) i posle svakog budjenja
+// objavljuje nepromenljiv snimak stanja kroz trostruki bafer; pri ubrzanju to je stanje posle poslednjeg
+// od svih koraka tog budjenja. Prikaz samo cita poslednji snimak. Dogadjaji se prijavljuju po koraku.
+
+const double SIMULATION_THREAD_RATE = 120.0;   // budjenja u sekundi
+
+// Ono sto prikaz sme da vidi; kopija, pa je ne menja nit simulacije
+struct RenderSnapshot {
+    SimulationState state;
+    float timeScale;
+    uint64_t sequence;   // redni broj objave
+};
+
+// Komande koje nit simulacije prosledjuje prikazu (on je vlasnik stanica i geometrije)
+enum DisplayRequest {
+    DISPLAY_REQUEST_SAVE = 1 << 0,
+    DISPLAY_REQUEST_LOAD = 1 << 1
+};
+
+struct SimulationThread {
+    Simulation* simulation;
+    InputQueue* input;
+    InputJournal* journal;             // 0 ako se ne snima dnevnik
+    SimulationEventCallback onEvents;  // poziva se na niti simulacije, jednom po koraku sa dogadjajima
+    TimeWarp warp;
+    double rate;
+
+    TripleBuffer<RenderSnapshot> snapshots;
+    // Drzi ga nit simulacije dok menja stanje; prikaz ga zakljucava samo za F5/F9
+    std::mutex stateMutex;
+    std::atomic<unsigned> displayRequests;
+    std::atomic<bool> running;
+    std::thread thread;
+    uint64_t sequence;
+    InputEvent inputBatch[INPUT_QUEUE_CAPACITY];
+
+    SimulationThread();
+    ~SimulationThread();
+    // Objavljuje pocetni snimak pre pokretanja niti, pa prikaz uvek ima sta da procita
+    void start(Simulation* simulation, InputQueue* input, InputJournal* journal, SimulationEventCallback onEvents);
+    void stop();
+
+    // Prikaz: najnoviji objavljen snimak (wait-free)
+    const RenderSnapshot& latest();
+    unsigned takeDisplayRequests();
+
+    // Jedna iteracija petlje niti: ulazi, koraci, objava; javna zbog headless testiranja
+    void tick(float dt);
+
+private:
+    void run();
+    void applyCommand(uint32_t command);
+    void publish();
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Opis: binarni snimak stanja simulacije (checkpoint) i brzo vracanje preko mmap.
+// Fajl je zaglavlje + tabela sekcija + sirovi nizovi poravnati na 64 bajta, u istom rasporedu kao u memoriji,
+// pa ucitavanje nema parsiranja: mapira se fajl, provere se zaglavlje i velicine elemenata, i nizovi se kopiraju
+// (ili se citaju direktno iz mape preko MappedSnapshot::section).
+
+struct Station;
+struct RouteGeometry;
+struct SimulationState;
+struct Fleet;
+struct PassengerPool;
+
+const uint32_t SNAPSHOT_MAGIC = 0x53535542u;   // "BUSS"
+const uint32_t SNAPSHOT_VERSION = 4;
+const int SNAPSHOT_MAX_SECTIONS = 16;
+
+enum SnapshotSectionId {
+    SNAPSHOT_STATIONS = 1,
+    SNAPSHOT_ROUTE_SEGMENTS,
+    SNAPSHOT_SIMULATION,
+    SNAPSHOT_FLEET_PROGRESS,
+    SNAPSHOT_FLEET_TIMER,
+    SNAPSHOT_FLEET_SEGMENT,
+    SNAPSHOT_FLEET_FLAGS,
+    SNAPSHOT_PASSENGERS,
+    SNAPSHOT_PASSENGER_POOL
+};
+
+struct SnapshotSection {
+    uint32_t id;
+    uint32_t elementSize;
+    uint64_t offset;
+    uint64_t count;
+};
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t reserved;
+    uint64_t fileSize;
+    SnapshotSection sections[SNAPSHOT_MAX_SECTIONS];
+};
+
+// Sta se snima/vraca; null pokazivaci se preskacu
+struct SnapshotData {
+    Station* stations;
+    int stationCount;
+    RouteGeometry* route;
+    SimulationState* simulation;
+    Fleet* fleet;
+    PassengerPool* passengers;
+
+    SnapshotData();
+};
+
+bool saveSnapshot(const char* path, const SnapshotData& data);
+
+struct MappedSnapshot {
+    const unsigned char* base;
+    size_t size;
+    void* fileHandle;
+    void* mappingHandle;
+
+    MappedSnapshot();
+    ~MappedSnapshot();
+
+    bool open(const char* path);
+    void close();
+    const SnapshotHeader* header() const { return (const SnapshotHeader*)base; }
+
+    // Pokazivac na niz unutar mape (bez kopiranja), null ako sekcija ne postoji ili nije ocekivanog rasporeda
+    const void* section(uint32_t id, uint32_t elementSize, uint64_t* count) const;
+};
+
+bool restoreSnapshot(const MappedSnapshot& snapshot, SnapshotData& data);
+bool loadSnapshot(const char* path, SnapshotData& data);
@@ -0,0 +1,34 @@
+#pragma once
+#include "SpriteList.h"
+#include "ShaderProgram.h"
+
+// Opis: crtanje sprajtova u paketu - svi kvadrati frejma idu u jedan VBO koji se puni iznova svaki frejm,
+// a crta se jednim glDrawElements po teksturi (SpriteList::runs) umesto jednim po sprajtu.
+
+struct SpriteBatchStats {
+    int sprites;
+    int drawCalls;
+};
+
+struct SpriteBatch {
+    ShaderProgram shader;
+    int textureUniform;
+    unsigned int vao, vbo, ebo;
+    int capacity;   // kvadrata u EBO-u
+    SpriteList list;
+    SpriteBatchStats stats;
+
+    SpriteBatch();
+    bool init(const char* vertexPath, const char* fragmentPath);
+    void destroy();
+
+    void begin();
+    void draw(unsigned int texture, float x, float y, float width, float height, float alpha = 1.0f, UvRect uv = UV_FULL, int layer = SPRITE_LAYER_MAP) {
+        list.add(texture, x, y, width, height, alpha, uv, layer);
+    }
+    // Sortira, salje temena i crta; ostavlja svoj program i VAO aktivnim
+    void end();
+
+private:
+    void reserveQuads(int quads);
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Opis: priprema sprajtova za crtanje u paketu, bez OpenGL poziva (crta ih SpriteBatch).
+// Sprajtovi se sortiraju po sloju pa po teksturi; susedni sa istom teksturom postaju jedan poziv crtanja.
+// Unutar istog sloja i teksture redosled dodavanja se cuva.
+
+struct UvRect {
+    float u0, v0, u1, v1;
+};
+
+const UvRect UV_FULL = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+// Slojevi idu odozdo nagore; sprajt viseg sloja je uvek preko nizeg
+enum SpriteLayer {
+    SPRITE_LAYER_MAP = 0,
+    SPRITE_LAYER_VEHICLES = 1,
+    SPRITE_LAYER_HUD = 2
+};
+
+struct Sprite {
+    unsigned int texture;
+    int layer;
+    uint32_t order;
+    float x, y, width, height;   // centar i velicina, kao jedinicni kvadrat skaliran u setModelMatrix
+    UvRect uv;
+    float alpha;
+};
+
+struct SpriteVertex {
+    float x, y;
+    float u, v;
+    float alpha;
+};
+
+// Uzastopni kvadrati sa istom teksturom
+struct SpriteRun {
+    unsigned int texture;
+    int firstQuad;
+    int quadCount;
+};
+
+struct SpriteList {
+    std::vector<Sprite> sprites;
+    std::vector<uint32_t> sorted;
+    std::vector<SpriteVertex> vertices;   // 4 po kvadratu
+    std::vector<SpriteRun> runs;
+
+    void clear();
+    void add(unsigned int texture, float x, float y, float width, float height, float alpha, UvRect uv = UV_FULL, int layer = SPRITE_LAYER_MAP);
+    // Sortira i puni vertices i runs
+    void build();
+    int size() const { return (int)sprites.size(); }
+};
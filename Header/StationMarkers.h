@@ -0,0 +1,53 @@
+#pragma once
+#include "Route.h"
+#include "SpriteList.h"
+#include "ShaderProgram.h"
+#include <vector>
+
+// Opis: stanice (krugovi i brojevi) se crtaju instancirano - jedan glDrawArraysInstanced po vrsti oznake,
+// bez obzira na broj stanica. Podaci po instanci (polozaj, velicina, boja, UV broja) su u jednom baferu
+// koji se puni samo kad se stanice promene (verzija RouteGeometry ili broj stanica).
+
+const int MARKER_CIRCLE_SEGMENTS = 50;
+const int MARKER_CIRCLE_VERTICES = MARKER_CIRCLE_SEGMENTS + 2;   // centar lepeze i obod, prva tacka oboda se ponavlja
+
+struct MarkerInstance {
+    float x, y;
+    float width, height;   // poluprecnik kruga, odnosno velicina oznake
+    float r, g, b, a;
+    UvRect uv;
+};
+
+struct StationMarkerStyle {
+    float radius;
+    float color[3];
+    float labelWidth, labelHeight;
+};
+
+struct TextureAtlas;
+
+struct StationMarkers {
+    ShaderProgram shader;
+    int useTextureUniform;
+    unsigned int circleVAO, circleVBO;
+    unsigned int labelVAO, labelVBO;
+    unsigned int instanceVBO;
+    unsigned int labelTexture;
+    int count;
+    unsigned int builtVersion;
+    bool built;
+    StationMarkerStyle style;
+    std::vector<MarkerInstance> instances;   // prvo "count" krugova, pa "count" brojeva
+
+    StationMarkers();
+    bool init(const char* vertexPath, const char* fragmentPath, const StationMarkerStyle& markerStyle);
+    void destroy();
+
+    // Vraca true ako je bafer instanci ponovo napunjen
+    bool update(const Station* stations, int stationCount, unsigned int routeVersion, const TextureAtlas& atlas);
+    // Dva poziva crtanja: svi krugovi pa svi brojevi
+    void draw() const;
+
+private:
+    void setupInstanceAttributes(size_t firstInstance) const;
+};
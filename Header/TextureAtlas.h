@@ -0,0 +1,43 @@
+#pragma once
+#include "SpriteList.h"
+#include "Samplers.h"
+#include <vector>
+
+// Opis: sve slike iz "Resource Files/Textures" se pri pokretanju pakuju u jednu ili vise
+// stranica atlasa (AtlasPacker), pa sprajtovi dele teksturu i SpriteBatch ih crta jednim pozivom.
+// Sprajt se trazi po AssetId i dobija teksturu stranice i UV pravougaonik unutar nje.
+
+enum AssetId {
+    ASSET_BUS,
+    ASSET_STATION,
+    ASSET_CONTROL,
+    ASSET_DOOR_CLOSED,
+    ASSET_DOOR_OPEN,
+    ASSET_AUTHOR,
+    ASSET_PASSENGERS_LABEL,
+    ASSET_FINES_LABEL,
+    ASSET_NUMBER_0,   // ASSET_NUMBER_0 + cifra
+    ASSET_COUNT = ASSET_NUMBER_0 + 10
+};
+
+const int ATLAS_PAGE_SIZE = 512;
+// Slobodni pikseli oko svake slike; ivica slike se prepisuje u njih da linearno filtriranje ne hvata susede
+const int ATLAS_PADDING = 2;
+
+struct AtlasSprite {
+    unsigned int texture;
+    UvRect uv;
+};
+
+struct TextureAtlas {
+    std::vector<unsigned int> pages;
+    AtlasSprite sprites[ASSET_COUNT];
+
+    // Ucitava sve slike i pravi stranice; false ako neka slika ne postoji ili ne staje u stranicu
+    // Preset uzorkovanja se pamti uz svaku stranicu (Samplers.h)
+    bool build(int pageSize = ATLAS_PAGE_SIZE, SamplerPreset sampler = SAMPLER_LINEAR_CLAMP);
+    void destroy();
+    const AtlasSprite& operator[](int asset) const { return sprites[asset]; }
+};
+
+const char* assetPath(int asset);
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include "Simulation.h"
+
+// Opis: ubrzano izvrsavanje simulacije (time-warp) nezavisno od brzine prikaza.
+// U svakom frejmu simulacija odradi (dt * ubrzanje) / SIMULATION_DT koraka, a prikaz crta samo poslednje stanje.
+// Koraci imaju vremenski budzet po frejmu: ako se ne stignu, visak se odbacuje umesto da se gomila,
+// pa trajanje frejma ostaje isto bez obzira na ubrzanje.
+
+const float TIME_WARP_SCALES[] = { 1.0f, 2.0f, 5.0f, 10.0f, 20.0f, 50.0f, 100.0f, 200.0f, 500.0f, 1000.0f };
+const int TIME_WARP_SCALE_COUNT = sizeof(TIME_WARP_SCALES) / sizeof(TIME_WARP_SCALES[0]);
+const double TIME_WARP_BUDGET = 0.004;        // sekundi stvarnog vremena za korake simulacije po iscrtanom frejmu
+const float TIME_WARP_MAX_FRAME_DT = 0.25f;   // duzi frejm (npr. pomeranje prozora) se ne nadoknadjuje
+const int TIME_WARP_CHUNK = 256;              // koraka izmedju dva citanja sata
+
+// Dogadjaji jednog koraka i stanje odmah posle njega
+typedef void (*SimulationEventCallback)(unsigned events, const SimulationState& state);
+
+struct TimeWarpStats {
+    uint64_t steps;
+    uint64_t droppedSteps;
+    double seconds;
+};
+
+struct TimeWarp {
+    int scaleIndex;
+    double accumulator;
+    double budget;
+    // Ukupno od pocetka, za ispis
+    uint64_t totalSteps;
+    uint64_t totalDroppedSteps;
+
+    TimeWarp();
+    float scale() const;
+    void faster();
+    void slower();
+    void resetScale();
+
+    // Vraca OR dogadjaja svih koraka u frejmu; onEvents (ako postoji) dobija dogadjaje svakog koraka posebno,
+    // pa se pri ubrzanju ne gube dolasci na stanice ni kazne iz ranijih koraka istog frejma
+    unsigned advance(Simulation& simulation, float frameDt, TimeWarpStats* stats = 0, SimulationEventCallback onEvents = 0);
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Simulation.h"
+
+struct RouteGeometry;
+
+// Opis: red voznje kao indeks kumulativnih vremena, za upite "sledeci dolazak na stanicu X posle T"
+// i "gde je autobus B u trenutku T" binarnom pretragom, bez ponovnog pokretanja simulacije.
+// Vremena su u tikovima simulacije (SIMULATION_DT), izracunata istom float aritmetikom kao Simulation::step,
+// pa se predvidjeni dolasci poklapaju sa simulacijom tacno na tik.
+// Svi autobusi voze istu kruznu rutu, pa je svaki opisan samo svojim pocetkom kruga (origin):
+// tik u kome je stigao (ili bi stigao) na stanicu 0, po modulu trajanja kruga.
+
+struct BusPosition {
+    int segment;        // stanica na kojoj ceka, odnosno od koje je krenuo
+    bool atStation;
+    float progress;     // udeo predjenog luka, 0 na stanici
+};
+
+struct Timetable {
+    int stationCount;
+    // Po stanici s: dolazak i polazak u odnosu na dolazak na stanicu 0 (arrivalOffset[0] = 0)
+    std::vector<uint64_t> arrivalOffset;
+    std::vector<uint64_t> departureOffset;
+    // Prirast udela luka po tiku voznje na segmentu s
+    std::vector<float> progressPerTick;
+    uint64_t cycleTicks;
+
+    // Po autobusu, i isti pocetci sortirani da bi dolazak bilo kog autobusa bio jedna binarna pretraga
+    std::vector<uint64_t> busOrigin;
+    std::vector<uint64_t> sortedOrigins;
+    std::vector<int> sortedBuses;
+
+    Timetable();
+
+    // dwellTicks[s]: cekanje na stanici s, travelTicks[s]: voznja od s do s + 1
+    void build(int stationCount, const uint64_t* dwellTicks, const uint64_t* travelTicks);
+    // Trajanja po modelu iz Simulation (STATION_WAIT_TIME, BUS_SPEED po udelu luka) za svaki segment rute
+    void build(const RouteGeometry& route);
+
+    // Redni broj autobusa, -1 ako red voznje jos nije napravljen (build)
+    int addBus(uint64_t origin = 0);
+    int busCount() const { return (int)busOrigin.size(); }
+
+    // Inkrementalno azuriranje jednog autobusa iz zivog stanja, O(log n) pretraga + pomeranje niza
+    void syncBus(int bus, int station, bool atStation, float stationTimer, float progress, uint64_t tick);
+    void syncBus(int bus, const SimulationState& state);
+
+    // Prvi dolazak na stanicu u tiku >= tick; bus (opciono) dobija autobus koji stize, -1 ako nema autobusa
+    uint64_t nextArrival(int station, uint64_t tick, int* bus = 0) const;
+    BusPosition busPosition(int bus, uint64_t tick) const;
+
+private:
+    void setOrigin(int bus, uint64_t origin);
+};
+
+// Broj tikova od SIMULATION_DT dok zbir ne dostigne "limit", sabirano kao u Simulation::step
+uint64_t ticksUntil(float limit, float increment);
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Opis: wait-free trostruki bafer za jednog pisca i jednog citaoca.
+// Pisac puni svoj bafer i objavljuje ga zamenom sa srednjim; citalac uzima srednji samo ako je nov.
+// Nijedna strana nikad ne ceka drugu, a objavljeni bafer se vise ne menja dok ga citalac drzi.
+
+template <typename T>
+struct TripleBuffer {
+    static const uint32_t INDEX_MASK = 3;
+    static const uint32_t FRESH = 4;   // srednji bafer jos nije procitan
+
+    T buffers[3];
+    std::atomic<uint32_t> middle;      // indeks srednjeg bafera | FRESH
+    uint32_t writeIndex;               // samo pisac
+    uint32_t readIndex;                // samo citalac
+
+    TripleBuffer() : middle(1), writeIndex(0), readIndex(2) {}
+
+    // ========== PISAC ==========
+    T& writeBuffer() {
+        return buffers[writeIndex];
+    }
+
+    void publish() {
+        // Release: citalac koji preuzme ovaj bafer vidi sve upise u njega
+        writeIndex = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // ========== CITALAC ==========
+    // Vraca true ako je preuzet novi bafer; inace ostaje poslednji procitani
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    const T& readBuffer() const {
+        return buffers[readIndex];
+    }
+};
@@ -2,7 +2,8 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <string>
+#include "Samplers.h"
 int endProgram(std::string message);
 unsigned int createShader(const char* vsSource, const char* fsSource);
-unsigned loadImageToTexture(const char* filePath);
+unsigned loadImageToTexture(const char* filePath, SamplerPreset sampler = SAMPLER_LINEAR_CLAMP);
 GLFWcursor* loadImageToCursor(const char* filePath);
\ No newline at end of file
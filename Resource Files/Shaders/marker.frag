@@ -0,0 +1,17 @@
+#version 330 core
+
+in vec2 chTex;
+in vec4 chColor;
+out vec4 outCol;
+
+uniform sampler2D uTex;
+uniform int uUseTexture;
+
+void main()
+{
+	if (uUseTexture == 1) {
+		outCol = texture(uTex, chTex) * chColor;
+	} else {
+		outCol = chColor;
+	}
+}
\ No newline at end of file
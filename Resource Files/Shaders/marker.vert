@@ -0,0 +1,25 @@
+#version 330 core
+
+layout(location = 0) in vec2 inPos;
+layout(location = 1) in vec2 inTex;
+// Po instanci (glVertexAttribDivisor 1)
+layout(location = 2) in vec2 inCenter;
+layout(location = 3) in vec2 inSize;
+layout(location = 4) in vec4 inColor;
+layout(location = 5) in vec4 inUvRect;
+
+out vec2 chTex;
+out vec4 chColor;
+
+layout(std140) uniform FrameData {
+	mat4 uView;
+	float uTime;
+	float uAspect;
+};
+
+void main()
+{
+	gl_Position = uView * vec4(inCenter + inPos * inSize, 0.0, 1.0);
+	chTex = mix(inUvRect.xy, inUvRect.zw, inTex);
+	chColor = inColor;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#version 330 core
+
+flat in uint chLine;
+out vec4 outCol;
+
+uniform sampler2D uPalette;
+
+void main()
+{
+	int size = textureSize(uPalette, 0).x;
+	outCol = texelFetch(uPalette, ivec2(int(chLine) % size, 0), 0);
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#version 330 core
+
+layout(location = 0) in vec2 inPos;
+layout(location = 1) in uint inLine;
+
+flat out uint chLine;
+
+layout(std140) uniform FrameData {
+	mat4 uView;
+	float uTime;
+	float uAspect;
+};
+
+void main()
+{
+	gl_Position = uView * vec4(inPos, 0.0, 1.0);
+	chLine = inLine;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#version 330 core
+
+in vec2 chTex;
+in float chAlpha;
+out vec4 outCol;
+
+uniform sampler2D uTex;
+
+void main()
+{
+	vec4 texColor = texture(uTex, chTex);
+	outCol = vec4(texColor.rgb, texColor.a * chAlpha);
+}
\ No newline at end of file
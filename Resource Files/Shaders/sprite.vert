@@ -0,0 +1,22 @@
+#version 330 core
+
+layout(location = 0) in vec2 inPos;
+layout(location = 1) in vec2 inTex;
+layout(location = 2) in float inAlpha;
+
+out vec2 chTex;
+out float chAlpha;
+
+layout(std140) uniform FrameData {
+	mat4 uView;
+	float uTime;
+	float uAspect;
+};
+
+// Temena su vec u koordinatama sveta (SpriteList), pa nema matrice modela
+void main()
+{
+	gl_Position = uView * vec4(inPos, 0.0, 1.0);
+	chTex = inTex;
+	chAlpha = inAlpha;
+}
\ No newline at end of file
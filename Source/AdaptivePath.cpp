@@ -0,0 +1,60 @@
+#include "../Header/AdaptivePath.h"
+#include "../Header/Route.h"
+#include "../Header/BezierBatch.h"
+
+#include <cmath>
+
+int quadraticSegmentsForTolerance(Vec2 p0, Vec2 p1, Vec2 p2, float pixelsPerUnit, float tolerancePixels) {
+    // Drugi izvod kvadratne krive je konstantan, pa je jedna vrednost dovoljna za ceo segment
+    float ddx = (p0.x - 2.0f * p1.x + p2.x) * pixelsPerUnit;
+    float ddy = (p0.y - 2.0f * p1.y + p2.y) * pixelsPerUnit;
+    float dd = sqrt(ddx * ddx + ddy * ddy);
+    int n = (int)ceil(sqrt(dd / (4.0f * tolerancePixels)));
+    if (n < 1) return 1;
+    if (n > PATH_MAX_SEGMENTS) return PATH_MAX_SEGMENTS;
+    return n;
+}
+
+AdaptivePath::AdaptivePath() {
+    tolerancePixels = PATH_TOLERANCE_PIXELS;
+    builtScale = 0.0f;
+    builtVersion = 0;
+    built = false;
+}
+
+bool AdaptivePath::update(const RouteGeometry& route, float pixelsPerUnit) {
+    bool rescaled = pixelsPerUnit > builtScale * PATH_RESCALE_UP || pixelsPerUnit < builtScale * PATH_RESCALE_DOWN;
+    if (built && route.version == builtVersion && !rescaled) {
+        return false;
+    }
+    rebuild(route, pixelsPerUnit);
+    return true;
+}
+
+void AdaptivePath::rebuild(const RouteGeometry& route, float pixelsPerUnit) {
+    int count = route.segmentCount();
+    float params[PATH_MAX_SEGMENTS + 1];
+    float pointsX[PATH_MAX_SEGMENTS + 1];
+    float pointsY[PATH_MAX_SEGMENTS + 1];
+
+    vertices.clear();
+    ranges.resize(count);
+    for (int i = 0; i < count; i++) {
+        const RouteSegment& seg = route.segments[i];
+        int n = quadraticSegmentsForTolerance(seg.p0, seg.p1, seg.p2, pixelsPerUnit, tolerancePixels);
+        for (int j = 0; j <= n; j++) {
+            params[j] = (float)j / (float)n;
+        }
+        bezierQuadraticBatch(seg.p0, seg.p1, seg.p2, params, pointsX, pointsY, n + 1);
+
+        ranges[i].first = (int)vertices.size() / 2;
+        ranges[i].count = n + 1;
+        for (int j = 0; j <= n; j++) {
+            vertices.push_back(pointsX[j]);
+            vertices.push_back(pointsY[j]);
+        }
+    }
+    builtScale = pixelsPerUnit;
+    builtVersion = route.version;
+    built = true;
+}
@@ -0,0 +1,135 @@
+#include "../Header/AtlasPacker.h"
+
+#include <algorithm>
+
+SkylinePacker::SkylinePacker() {
+    width = height = 0;
+    usedArea = 0;
+}
+
+void SkylinePacker::init(int pageWidth, int pageHeight) {
+    width = pageWidth;
+    height = pageHeight;
+    usedArea = 0;
+    skyline.clear();
+    SkylineNode first = { 0, 0, pageWidth };
+    skyline.push_back(first);
+}
+
+int SkylinePacker::fitHeight(int index, int rectWidth, int rectHeight) const {
+    int x = skyline[index].x;
+    if (x + rectWidth > width) {
+        return -1;
+    }
+    // Pravougaonik lezi na najvisem cvoru ispod sebe
+    int y = 0;
+    int remaining = rectWidth;
+    for (int i = index; remaining > 0; i++) {
+        y = std::max(y, skyline[i].y);
+        if (y + rectHeight > height) {
+            return -1;
+        }
+        remaining -= skyline[i].width;
+    }
+    return y;
+}
+
+void SkylinePacker::addLevel(int index, int x, int y, int rectWidth, int rectHeight) {
+    SkylineNode node = { x, y + rectHeight, rectWidth };
+    skyline.insert(skyline.begin() + index, node);
+
+    // Cvorovi desno koje novi pokriva se skracuju ili brisu
+    for (size_t i = index + 1; i < skyline.size(); i++) {
+        int end = skyline[i - 1].x + skyline[i - 1].width;
+        if (skyline[i].x >= end) {
+            break;
+        }
+        int shrink = end - skyline[i].x;
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+        if (skyline[i].width > 0) {
+            break;
+        }
+        skyline.erase(skyline.begin() + i);
+        i--;
+    }
+
+    // Susedni cvorovi na istoj visini se spajaju
+    for (size_t i = 0; i + 1 < skyline.size(); i++) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+            i--;
+        }
+    }
+}
+
+bool SkylinePacker::insert(int rectWidth, int rectHeight, int* x, int* y) {
+    int bestIndex = -1;
+    int bestTop = height + 1;
+    int bestWidth = width + 1;
+    int bestY = 0;
+    for (int i = 0; i < (int)skyline.size(); i++) {
+        int fitY = fitHeight(i, rectWidth, rectHeight);
+        if (fitY < 0) {
+            continue;
+        }
+        // Najniza gornja ivica; kod izjednacenja uzi cvor, da siroki ostanu za siroke pravougaonike
+        int top = fitY + rectHeight;
+        if (top < bestTop || (top == bestTop && skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = skyline[i].width;
+            bestY = fitY;
+        }
+    }
+    if (bestIndex < 0) {
+        return false;
+    }
+
+    *x = skyline[bestIndex].x;
+    *y = bestY;
+    addLevel(bestIndex, *x, bestY, rectWidth, rectHeight);
+    usedArea += rectWidth * rectHeight;
+    return true;
+}
+
+int packAtlas(const int* widths, const int* heights, int count, int pageWidth, int pageHeight, int padding,
+    AtlasPlacement* placements, std::vector<SkylinePacker>* pages) {
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [heights](int a, int b) { return heights[a] > heights[b]; });
+
+    std::vector<SkylinePacker> packers;
+    for (int k = 0; k < count; k++) {
+        int i = order[k];
+        int w = widths[i] + 2 * padding;
+        int h = heights[i] + 2 * padding;
+        if (w > pageWidth || h > pageHeight) {
+            return 0;
+        }
+
+        // Prvo postojece stranice, nova tek ako nigde ne staje
+        int x = 0, y = 0;
+        int page = 0;
+        while (page < (int)packers.size() && !packers[page].insert(w, h, &x, &y)) {
+            page++;
+        }
+        if (page == (int)packers.size()) {
+            packers.push_back(SkylinePacker());
+            packers.back().init(pageWidth, pageHeight);
+            packers.back().insert(w, h, &x, &y);
+        }
+        placements[i].page = page;
+        placements[i].x = x + padding;
+        placements[i].y = y + padding;
+    }
+
+    int pageCount = (int)packers.size();
+    if (pages != 0) {
+        pages->swap(packers);
+    }
+    return pageCount;
+}
@@ -0,0 +1,1155 @@
+#include "../Header/Benchmark.h"
+#include "../Header/Simulation.h"
+#include "../Header/Fleet.h"
+#include "../Header/Route.h"
+#include "../Header/BezierBatch.h"
+#include "../Header/EventSimulation.h"
+#include "../Header/Random.h"
+#include "../Header/MonteCarlo.h"
+#include "../Header/PassengerPool.h"
+#include "../Header/Snapshot.h"
+#include "../Header/InputJournal.h"
+#include "../Header/TimeWarp.h"
+#include "../Header/InputQueue.h"
+#include "../Header/SimulationThread.h"
+#include "../Header/Timetable.h"
+#include "../Header/KioskRoute.h"
+#include "../Header/Curve.h"
+#include "../Header/AdaptivePath.h"
+#include "../Header/SpriteList.h"
+#include "../Header/AtlasPacker.h"
+#include "../Header/NetworkPolyline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+// ========== POMOCNE FUNKCIJE ==========
+typedef std::chrono::high_resolution_clock BenchClock;
+
+static double secondsSince(BenchClock::time_point start) {
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    return elapsed.count();
+}
+
+// Stanice na krugu sa malim odstupanjima, da benchmark ne zavisi od prozora
+static void makeBenchStations(Station* stations) {
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        float angle = 2.0f * 3.14159f * i / NUM_STATIONS;
+        float radius = 0.6f + 0.1f * sin(i * 1.3f);
+        stations[i].position = Vec2(radius * cos(angle), radius * sin(angle));
+        stations[i].number = i;
+    }
+}
+
+static void makeBenchFleet(Fleet& fleet, int size) {
+    fleet.reserve(size);
+    for (int b = 0; b < size; b++) {
+        // Autobusi su rasporedjeni po stanicama i sa razlicitim vremenom cekanja
+        fleet.addBus(b % NUM_STATIONS, (b * 0.37f) - (int)(b * 0.37f / STATION_WAIT_TIME) * STATION_WAIT_TIME);
+    }
+}
+
+// ========== SIMULACIJA ==========
+static void benchSimulation() {
+    const long long TICKS = 50000000;
+
+    Simulation sim;
+    long long arrivals = 0;
+    auto start = BenchClock::now();
+
+    for (long long tick = 0; tick < TICKS; tick++) {
+        unsigned events = sim.step(SIMULATION_DT);
+        if (events & EVENT_BUS_ARRIVED) {
+            // Skriptovani ulazi, da bi se prosla i grana sa kontrolom
+            arrivals++;
+            sim.handleInput(INPUT_ADD_PASSENGER);
+            sim.handleInput(INPUT_ADD_PASSENGER);
+            sim.handleInput(INPUT_REMOVE_PASSENGER);
+            if (arrivals % 2 == 0) {
+                sim.handleInput(INPUT_SEND_INSPECTOR);
+            }
+        }
+    }
+
+    double seconds = secondsSince(start);
+    double simulatedSeconds = TICKS * (double)SIMULATION_DT;
+    std::cout << "simulation: " << TICKS << " tikova za " << seconds << " s" << std::endl;
+    std::cout << "  " << (TICKS / seconds) << " tikova/s, " << (simulatedSeconds / seconds) << "x realno vreme" << std::endl;
+    std::cout << "  stanica " << sim.state.currentStation << ", putnika " << sim.state.passengers
+        << ", kazni " << sim.state.totalFines << std::endl;
+}
+
+// ========== FLOTA ==========
+static void benchFleet() {
+    // Ukupan broj (autobus x tik) je priblizno isti za svaku velicinu flote
+    const long long WORK = 200000000;
+    const int SIZES[] = { 1, 10, 100, 1000, 10000, 100000 };
+
+    for (int size : SIZES) {
+        Fleet fleet;
+        makeBenchFleet(fleet, size);
+
+        long long ticks = WORK / size;
+        long long arrivals = 0;
+        auto start = BenchClock::now();
+        for (long long tick = 0; tick < ticks; tick++) {
+            arrivals += fleet.step(SIMULATION_DT);
+        }
+        double seconds = secondsSince(start);
+        double busTicks = (double)ticks * size;
+
+        std::cout << "fleet " << size << " autobusa: " << ticks << " tikova, "
+            << (busTicks / seconds) << " autobus-tikova/s, "
+            << (seconds * 1e9 / busTicks) << " ns/autobus-tik, dolazaka " << arrivals << std::endl;
+    }
+}
+
+// ========== POZICIJE NA RUTI ==========
+static void benchRoutePositions() {
+    const int BUSES = 100000;
+    const int ROUNDS = 200;
+
+    Station stations[NUM_STATIONS];
+    makeBenchStations(stations);
+
+    RouteGeometry route;
+    auto buildStart = BenchClock::now();
+    route.build(stations, NUM_STATIONS);
+    std::cout << "geometrija rute: " << NUM_STATIONS << " segmenata za " << secondsSince(buildStart) * 1e6 << " us" << std::endl;
+
+    Fleet fleet;
+    makeBenchFleet(fleet, BUSES);
+    for (int tick = 0; tick < 1000; tick++) {
+        fleet.step(SIMULATION_DT);
+    }
+
+    std::vector<float> outX(BUSES), outY(BUSES), params(BUSES);
+    double checksum = 0.0;
+
+    // Stari nacin: kontrolna tacka i polinom za svaki upit, progress kao parametar t
+    auto start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int b = 0; b < BUSES; b++) {
+            int seg = fleet.segment[b];
+            Vec2 p0 = stations[seg].position;
+            Vec2 p2 = stations[(seg + 1) % NUM_STATIONS].position;
+            Vec2 pos = bezierQuadratic(p0, segmentControlPoint(p0, p2, seg), p2, fleet.progress[b]);
+            outX[b] = pos.x;
+            outY[b] = pos.y;
+        }
+        checksum += outX[r % BUSES];
+    }
+    double directSeconds = secondsSince(start);
+
+    start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        fleet.computePositions(route, params.data(), outX.data(), outY.data());
+        checksum += outX[r % BUSES];
+    }
+    double tableSeconds = secondsSince(start);
+
+    double queries = (double)BUSES * ROUNDS;
+    std::cout << "direktno (bezierQuadratic): " << (directSeconds * 1e9 / queries) << " ns/upit" << std::endl;
+    std::cout << "tabela duzine luka: " << (tableSeconds * 1e9 / queries) << " ns/upit" << std::endl;
+    std::cout << "  (kontrolni zbir " << checksum << ")" << std::endl;
+}
+
+// ========== PAKETNI BEZIER ==========
+static void benchBezierBatch() {
+    const int PARAMS = 1024;
+    const int BATCH_ROUNDS = 50000;
+    const int BUSES = 100000;
+    const int INDEXED_ROUNDS = 500;
+
+    Station stations[NUM_STATIONS];
+    makeBenchStations(stations);
+    RouteGeometry route;
+    route.build(stations, NUM_STATIONS);
+    const RouteSegment& seg = route.segments[0];
+
+    std::vector<float> params(PARAMS), outX(BUSES), outY(BUSES);
+    for (int i = 0; i < PARAMS; i++) {
+        params[i] = (float)i / (PARAMS - 1);
+    }
+    std::vector<int> busSegment(BUSES);
+    std::vector<float> busParams(BUSES);
+    for (int b = 0; b < BUSES; b++) {
+        busSegment[b] = (b * 7) % NUM_STATIONS;
+        busParams[b] = (float)((b * 37) % 1000) / 1000.0f;
+    }
+
+    double checksum = 0.0;
+
+    // Referenca: bezierQuadratic tacku po tacku
+    auto start = BenchClock::now();
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        for (int i = 0; i < PARAMS; i++) {
+            Vec2 point = bezierQuadratic(seg.p0, seg.p1, seg.p2, params[i]);
+            outX[i] = point.x;
+            outY[i] = point.y;
+        }
+        checksum += outX[r % PARAMS];
+    }
+    double referenceBatch = secondsSince(start);
+
+    start = BenchClock::now();
+    for (int r = 0; r < INDEXED_ROUNDS; r++) {
+        for (int b = 0; b < BUSES; b++) {
+            const RouteSegment& s = route.segments[busSegment[b]];
+            Vec2 point = bezierQuadratic(s.p0, s.p1, s.p2, busParams[b]);
+            outX[b] = point.x;
+            outY[b] = point.y;
+        }
+        checksum += outX[r % BUSES];
+    }
+    double referenceIndexed = secondsSince(start);
+
+    std::cout << "bezierQuadratic: jedna kriva " << (referenceBatch * 1e9 / ((double)PARAMS * BATCH_ROUNDS)) << " ns/tacka, "
+        << "flota " << (referenceIndexed * 1e9 / ((double)BUSES * INDEXED_ROUNDS)) << " ns/tacka" << std::endl;
+
+    BezierKernel best = bezierBestKernel();
+    for (int k = BEZIER_KERNEL_SCALAR; k <= best; k++) {
+        bezierSetKernel((BezierKernel)k);
+
+        start = BenchClock::now();
+        for (int r = 0; r < BATCH_ROUNDS; r++) {
+            bezierQuadraticBatch(seg.p0, seg.p1, seg.p2, params.data(), outX.data(), outY.data(), PARAMS);
+            checksum += outX[r % PARAMS];
+        }
+        double batchSeconds = secondsSince(start);
+
+        start = BenchClock::now();
+        for (int r = 0; r < INDEXED_ROUNDS; r++) {
+            bezierQuadraticIndexed(route.curves, busSegment.data(), busParams.data(), outX.data(), outY.data(), BUSES);
+            checksum += outX[r % BUSES];
+        }
+        double indexedSeconds = secondsSince(start);
+
+        std::cout << bezierKernelName((BezierKernel)k) << ": jedna kriva " << (batchSeconds * 1e9 / ((double)PARAMS * BATCH_ROUNDS)) << " ns/tacka ("
+            << (referenceBatch / batchSeconds) << "x), flota " << (indexedSeconds * 1e9 / ((double)BUSES * INDEXED_ROUNDS)) << " ns/tacka ("
+            << (referenceIndexed / indexedSeconds) << "x)" << std::endl;
+    }
+    bezierSetKernel(best);
+
+    std::cout << "  (kontrolni zbir " << checksum << ")" << std::endl;
+}
+
+// ========== SIMULACIJA PO DOGADJAJIMA ==========
+static void benchEventSimulation() {
+    const double DAY = 24.0 * 60.0 * 60.0;
+    const int FLEET_SIZE = 1000;
+
+    // Fiksni korak: ceo dan, frejm po frejm
+    long long ticks = (long long)(DAY / SIMULATION_DT);
+    Simulation sim;
+    long long fixedArrivals = 0;
+    auto start = BenchClock::now();
+    for (long long tick = 0; tick < ticks; tick++) {
+        if (sim.step(SIMULATION_DT) & EVENT_BUS_ARRIVED) {
+            fixedArrivals++;
+        }
+    }
+    double fixedSeconds = secondsSince(start);
+
+    // Po dogadjajima: isti dan, jedan autobus (polazi posle prvog cekanja, kao Simulation)
+    EventSimulation events;
+    start = BenchClock::now();
+    events.addBus(0, STATION_WAIT_TIME);
+    events.runUntil(DAY);
+    double eventSeconds = secondsSince(start);
+
+    std::cout << "dan sa jednim autobusom:" << std::endl;
+    std::cout << "  fiksni korak: " << ticks << " tikova, " << (fixedSeconds * 1e3) << " ms, dolazaka " << fixedArrivals << std::endl;
+    std::cout << "  dogadjaji: " << (events.stats.departures + events.stats.arrivals) << " dogadjaja, "
+        << (eventSeconds * 1e6) << " us, dolazaka " << events.stats.arrivals << std::endl;
+
+    events.reset();
+    start = BenchClock::now();
+    for (int b = 0; b < FLEET_SIZE; b++) {
+        events.addBus(b % NUM_STATIONS, STATION_WAIT_TIME + (b * 0.37) - (int)(b * 0.37 / STATION_WAIT_TIME) * STATION_WAIT_TIME);
+    }
+    events.runUntil(DAY);
+    eventSeconds = secondsSince(start);
+    long long processed = events.stats.departures + events.stats.arrivals;
+    std::cout << "dan sa " << FLEET_SIZE << " autobusa: " << processed << " dogadjaja, " << (eventSeconds * 1e3) << " ms, "
+        << (processed / eventSeconds) << " dogadjaja/s" << std::endl;
+}
+
+// ========== SLUCAJNI BROJEVI ==========
+static void benchRandom() {
+    const int SINGLE = 50000000;
+    const int BULK = 1 << 20;
+    const int BULK_ROUNDS = 100;
+
+    uint64_t checksum = 0;
+    auto start = BenchClock::now();
+    for (int i = 0; i < SINGLE; i++) {
+        checksum += randomBits(12345, (uint32_t)(i & 1023), (uint32_t)i);
+    }
+    double singleSeconds = secondsSince(start);
+
+    std::vector<uint32_t> bits(BULK);
+    std::vector<float> uniforms(BULK);
+    start = BenchClock::now();
+    for (int r = 0; r < BULK_ROUNDS; r++) {
+        randomFillBits(12345, (uint32_t)r, 0, bits.data(), BULK);
+        checksum += bits[r];
+    }
+    double bulkSeconds = secondsSince(start);
+
+    start = BenchClock::now();
+    double sum = 0.0;
+    for (int r = 0; r < BULK_ROUNDS; r++) {
+        randomFillUniform(12345, (uint32_t)r, 0, uniforms.data(), BULK);
+        sum += uniforms[r];
+    }
+    double uniformSeconds = secondsSince(start);
+
+    double bulkWords = (double)BULK * BULK_ROUNDS;
+    std::cout << "randomBits (blok po pozivu): " << (SINGLE / singleSeconds) << " poziva/s" << std::endl;
+    std::cout << "randomFillBits: " << (bulkWords / bulkSeconds) << " reci/s" << std::endl;
+    std::cout << "randomFillUniform: " << (bulkWords / uniformSeconds) << " brojeva/s" << std::endl;
+    std::cout << "  (kontrolni zbir " << checksum << ", " << sum << ")" << std::endl;
+}
+
+// ========== MONTE KARLO ==========
+static void benchMonteCarlo() {
+    const unsigned MODES[] = {
+        VARIANCE_REDUCTION_NONE,
+        VARIANCE_REDUCTION_ANTITHETIC,
+        VARIANCE_REDUCTION_CONTROL_VARIATE
+    };
+    const char* NAMES[] = { "bez smanjenja varijanse", "antiteticki", "kontrolna promenljiva" };
+
+    MonteCarloConfig config;
+    config.trips = 100000000;
+    for (int m = 0; m < 3; m++) {
+        config.varianceReduction = MODES[m];
+        MonteCarloResult result = estimateFines(config);
+        std::cout << "--- " << NAMES[m] << " ---" << std::endl;
+        printMonteCarloResult(config, result);
+    }
+}
+
+// ========== PUTNICI ==========
+static void benchPassengers() {
+    const int BUSES = 1000;
+    const int OPERATIONS = 20000000;
+    const int CAPACITY = MAX_PASSENGERS;
+
+    // Isti niz ukrcavanja/iskrcavanja za obe verzije
+    std::vector<uint32_t> bits(OPERATIONS);
+    randomFillBits(777, 0, 0, bits.data(), bits.size());
+
+    // Naivno: new/delete po putniku, std::vector pokazivaca po autobusu
+    long long naiveAllocations = 0;
+    long long checksum = 0;
+    {
+        std::vector<std::vector<Passenger*> > onboard(BUSES);
+        auto start = BenchClock::now();
+        for (int i = 0; i < OPERATIONS; i++) {
+            int bus = (int)(((uint64_t)bits[i] * BUSES) >> 32);
+            std::vector<Passenger*>& list = onboard[bus];
+            bool board = (bits[i] & 1) != 0 ? (int)list.size() < CAPACITY : list.empty();
+            if (board) {
+                if (list.size() == list.capacity()) naiveAllocations++;
+                Passenger* p = new Passenger();
+                naiveAllocations++;
+                p->boardingStation = (int16_t)(i % NUM_STATIONS);
+                p->alightingStation = -1;
+                p->fareStatus = FARE_UNCHECKED;
+                list.push_back(p);
+            }
+            else {
+                Passenger* p = list.back();
+                list.pop_back();
+                checksum += p->boardingStation;
+                delete p;
+            }
+        }
+        double seconds = secondsSince(start);
+        std::cout << "new/std::vector: " << (OPERATIONS / seconds) << " operacija/s, alokacija " << naiveAllocations << std::endl;
+        for (int b = 0; b < BUSES; b++) {
+            for (size_t j = 0; j < onboard[b].size(); j++) delete onboard[b][j];
+        }
+    }
+
+    // Arena: lista putnika po autobusu kroz "next", slobodna mesta se recikliraju
+    {
+        PassengerPool pool;
+        std::vector<uint32_t> head(BUSES, PASSENGER_NONE);
+        std::vector<int> count(BUSES, 0);
+        auto start = BenchClock::now();
+        for (int i = 0; i < OPERATIONS; i++) {
+            int bus = (int)(((uint64_t)bits[i] * BUSES) >> 32);
+            bool board = (bits[i] & 1) != 0 ? count[bus] < CAPACITY : count[bus] == 0;
+            if (board) {
+                uint32_t index = pool.allocate(i % NUM_STATIONS);
+                pool[index].next = head[bus];
+                head[bus] = index;
+                count[bus]++;
+            }
+            else {
+                uint32_t index = head[bus];
+                head[bus] = pool[index].next;
+                count[bus]--;
+                checksum -= pool[index].boardingStation;
+                pool.release(index);
+            }
+        }
+        double seconds = secondsSince(start);
+        std::cout << "PassengerPool: " << (OPERATIONS / seconds) << " operacija/s, alokacija " << pool.chunkAllocations
+            << " (kapacitet " << pool.capacity << ", zivih " << pool.live << ")" << std::endl;
+    }
+    std::cout << "  (kontrolna razlika " << checksum << ")" << std::endl;
+}
+
+// ========== SNIMAK STANJA ==========
+static void benchSnapshot() {
+    const int BUSES = 100000;
+    const int PASSENGERS = 1000000;
+    const char* PATH = "benchmark.snap";
+
+    Station stations[NUM_STATIONS];
+    makeBenchStations(stations);
+    RouteGeometry route;
+    route.build(stations, NUM_STATIONS);
+
+    Simulation sim(99);
+    for (int tick = 0; tick < 100000; tick++) {
+        sim.step(SIMULATION_DT);
+    }
+
+    Fleet fleet;
+    makeBenchFleet(fleet, BUSES);
+    for (int tick = 0; tick < 500; tick++) {
+        fleet.step(SIMULATION_DT);
+    }
+
+    PassengerPool pool;
+    for (int i = 0; i < PASSENGERS; i++) {
+        pool.allocate(i % NUM_STATIONS);
+    }
+
+    SnapshotData data;
+    data.stations = stations;
+    data.stationCount = NUM_STATIONS;
+    data.route = &route;
+    data.simulation = &sim.state;
+    data.fleet = &fleet;
+    data.passengers = &pool;
+
+    auto start = BenchClock::now();
+    bool saved = saveSnapshot(PATH, data);
+    double saveSeconds = secondsSince(start);
+
+    Station restoredStations[NUM_STATIONS];
+    RouteGeometry restoredRoute;
+    SimulationState restoredState;
+    Fleet restoredFleet;
+    PassengerPool restoredPool;
+    SnapshotData target;
+    target.stations = restoredStations;
+    target.stationCount = NUM_STATIONS;
+    target.route = &restoredRoute;
+    target.simulation = &restoredState;
+    target.fleet = &restoredFleet;
+    target.passengers = &restoredPool;
+
+    start = BenchClock::now();
+    MappedSnapshot mapped;
+    bool opened = mapped.open(PATH);
+    double mapSeconds = secondsSince(start);
+    bool restored = opened && restoreSnapshot(mapped, target);
+    double restoreSeconds = secondsSince(start);
+    size_t fileSize = mapped.size;
+    mapped.close();
+    remove(PATH);
+
+    bool same = restored && restoredState.totalFines == sim.state.totalFines && restoredState.rngEvent == sim.state.rngEvent
+        && restoredFleet.segment == fleet.segment && restoredPool.live == pool.live
+        && restoredRoute.segments[3].length == route.segments[3].length;
+    std::cout << "snimak: " << (fileSize / (1024.0 * 1024.0)) << " MB, snimanje " << (saveSeconds * 1e3) << " ms"
+        << (saved ? "" : " (GRESKA)") << std::endl;
+    std::cout << "ucitavanje: mapiranje " << (mapSeconds * 1e3) << " ms, ukupno sa kopiranjem " << (restoreSeconds * 1e3) << " ms, "
+        << (same ? "stanje isto" : "GRESKA: stanje se razlikuje") << std::endl;
+}
+
+// ========== DNEVNIK ULAZA ==========
+static void benchJournal() {
+    // Sinteticka sesija od sat vremena: na svakoj stanici nekoliko ulaza, kontrola na svakoj trecoj
+    const long long TICKS = (long long)(3600.0f / SIMULATION_DT);
+    const char* PATH = "benchmark.journal";
+
+    Simulation sim(2024);
+    InputJournal journal;
+    journal.begin(sim.state.seed, sim.state.bus);
+    long long arrivals = 0;
+    for (long long tick = 0; tick < TICKS; tick++) {
+        if (sim.state.busAtStation && sim.state.stationTimer == 0.0f) {
+            for (int i = 0; i < 3; i++) {
+                journal.record(sim.state.tick, INPUT_ADD_PASSENGER);
+                sim.handleInput(INPUT_ADD_PASSENGER);
+            }
+            journal.record(sim.state.tick, INPUT_REMOVE_PASSENGER);
+            sim.handleInput(INPUT_REMOVE_PASSENGER);
+            if (arrivals++ % 3 == 0) {
+                journal.record(sim.state.tick, INPUT_SEND_INSPECTOR);
+                sim.handleInput(INPUT_SEND_INSPECTOR);
+            }
+        }
+        sim.step(SIMULATION_DT);
+    }
+    journal.finish(sim.state);
+    journal.save(PATH);
+
+    InputJournal loaded;
+    bool ok = loaded.load(PATH);
+    remove(PATH);
+    ReplayResult result = replayJournal(loaded);
+    double simulated = result.ticks * (double)SIMULATION_DT;
+
+    std::cout << "dnevnik: " << journal.eventCount << " ulaza u " << journal.bytes.size() << " bajtova ("
+        << ((double)journal.bytes.size() / journal.eventCount) << " B/ulaz)" << std::endl;
+    std::cout << "replay: " << result.ticks << " tikova za " << (result.seconds * 1e3) << " ms, "
+        << (simulated / result.seconds) << "x realno vreme, "
+        << (ok && result.matches ? "stanje se poklapa" : "GRESKA: stanje se ne poklapa") << std::endl;
+}
+
+// ========== UBRZANJE ==========
+static void benchTimeWarp() {
+    // Frejmovi od 1/75 s za svako ubrzanje; trajanje frejma treba da ostane ispod budzeta
+    const int FRAMES = 750;
+    const float FRAME_DT = 1.0f / 75.0f;
+
+    for (int s = 0; s < TIME_WARP_SCALE_COUNT; s++) {
+        Simulation sim(7);
+        TimeWarp warp;
+        warp.scaleIndex = s;
+        double total = 0.0, worst = 0.0;
+        for (int f = 0; f < FRAMES; f++) {
+            TimeWarpStats stats;
+            warp.advance(sim, FRAME_DT, &stats);
+            total += stats.seconds;
+            if (stats.seconds > worst) worst = stats.seconds;
+        }
+        std::cout << "ubrzanje " << warp.scale() << "x: " << (warp.totalSteps / FRAMES) << " koraka/frejm, prosek "
+            << (total / FRAMES * 1e3) << " ms, najgori " << (worst * 1e3) << " ms, odbaceno "
+            << warp.totalDroppedSteps << " koraka" << std::endl;
+    }
+
+    // Budzet: sa malim budzetom visak koraka se odbacuje, a frejm ne raste
+    Simulation sim(7);
+    TimeWarp warp;
+    warp.scaleIndex = TIME_WARP_SCALE_COUNT - 1;
+    warp.budget = 2e-6;
+    double worst = 0.0;
+    for (int f = 0; f < FRAMES; f++) {
+        TimeWarpStats stats;
+        warp.advance(sim, FRAME_DT, &stats);
+        if (stats.seconds > worst) worst = stats.seconds;
+    }
+    std::cout << "budzet 0.002 ms: najgori frejm " << (worst * 1e3) << " ms, izvrseno " << warp.totalSteps
+        << ", odbaceno " << warp.totalDroppedSteps << " koraka" << std::endl;
+}
+
+// ========== RED ULAZA ==========
+static void benchInputQueue() {
+    const uint32_t EVENTS = 20000000;
+    static InputQueue queue;
+    static InputEvent batch[INPUT_QUEUE_CAPACITY];
+
+    // Proizvodjac na drugoj niti; vreme nosi redni broj, da potrosac proveri redosled i da nista ne fali
+    auto start = BenchClock::now();
+    std::thread producer([]() {
+        for (uint32_t i = 0; i < EVENTS; i++) {
+            while (!queue.push((double)i, (InputCommand)(i % 3))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    uint32_t received = 0, drains = 0;
+    bool ordered = true;
+    while (received < EVENTS) {
+        uint32_t n = queue.drain(batch, INPUT_QUEUE_CAPACITY);
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t expected = received + i;
+            ordered &= batch[i].time == (double)expected && batch[i].command == expected % 3;
+        }
+        received += n;
+        drains += n > 0;
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    double seconds = secondsSince(start);
+
+    std::cout << "SPSC red: " << received << " ulaza za " << seconds << " s (" << (received / seconds / 1e6)
+        << " M/s), prosecno " << ((double)received / drains) << " po preuzimanju, "
+        << (ordered ? "redosled ocuvan" : "GRESKA: redosled narusen") << ", punih pokusaja " << queue.dropped << std::endl;
+
+    // Vise klikova u jednom frejmu: sa bool zastavicama bi to bio jedan putnik
+    Simulation sim(1);
+    for (int i = 0; i < 5; i++) {
+        queue.push(0.0, COMMAND_ADD_PASSENGER);
+    }
+    uint32_t n = queue.drain(batch, INPUT_QUEUE_CAPACITY);
+    for (uint32_t i = 0; i < n; i++) {
+        sim.handleInput((SimulationInput)batch[i].command);
+    }
+    std::cout << "5 klikova u jednom frejmu -> " << sim.state.passengers << " putnika" << std::endl;
+}
+
+// ========== NIT SIMULACIJE ==========
+struct BenchFrame {
+    uint64_t sequence;
+    uint64_t copies[15];
+};
+
+static void benchSimulationThread() {
+    // Trostruki bafer: citalac nikad ne sme da vidi delimicno upisan bafer
+    const uint64_t PUBLISHES = 5000000;
+    static TripleBuffer<BenchFrame> buffer;
+    static std::atomic<bool> writerDone(false);
+    std::thread writer([]() {
+        for (uint64_t i = 1; i <= PUBLISHES; i++) {
+            BenchFrame& frame = buffer.writeBuffer();
+            frame.sequence = i;
+            for (int c = 0; c < 15; c++) frame.copies[c] = i;
+            buffer.publish();
+        }
+        writerDone.store(true, std::memory_order_release);
+    });
+    uint64_t reads = 0, fresh = 0, torn = 0, backwards = 0, last = 0;
+    auto start = BenchClock::now();
+    while (!writerDone.load(std::memory_order_acquire)) {
+        if (buffer.update()) {
+            fresh++;
+        }
+        const BenchFrame& frame = buffer.readBuffer();
+        for (int c = 0; c < 15; c++) torn += frame.copies[c] != frame.sequence;
+        backwards += frame.sequence < last;
+        last = frame.sequence;
+        reads++;
+        if ((reads & 1023) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    double seconds = secondsSince(start);
+    writer.join();
+    std::cout << "trostruki bafer: " << PUBLISHES << " objava, " << reads << " citanja (" << fresh << " novih) za "
+        << seconds << " s, pocepanih " << torn << ", unazad " << backwards << std::endl;
+
+    // Simulacija na svojoj niti pri najvecem ubrzanju; "prikaz" cita snimke jednu sekundu
+    Simulation sim(3);
+    // Red je poravnat na liniju kesa; obican new to ne postuje pre C++17, pa je staticki kao u main
+    static InputQueue queue;
+    SimulationThread* thread = new SimulationThread();
+    thread->warp.scaleIndex = TIME_WARP_SCALE_COUNT - 1;
+    // Dolasci se broje po koraku; pri ubrzanju jedno budjenje pokrije vise stanica
+    static uint64_t arrivalEvents;
+    arrivalEvents = 0;
+    thread->start(&sim, &queue, 0, [](unsigned events, const SimulationState&) {
+        arrivalEvents += (events & EVENT_BUS_ARRIVED) != 0;
+    });
+    for (int i = 0; i < 5; i++) {
+        queue.push(0.0, COMMAND_ADD_PASSENGER);
+    }
+    uint64_t frames = 0, snapshots = 0, lastSequence = 0, lastTick = 0;
+    bool monotonic = true;
+    double worstRead = 0.0;
+    start = BenchClock::now();
+    while (secondsSince(start) < 1.0) {
+        auto readStart = BenchClock::now();
+        const RenderSnapshot& snapshot = thread->latest();
+        double read = secondsSince(readStart);
+        if (read > worstRead) worstRead = read;
+        monotonic &= snapshot.state.tick >= lastTick;
+        lastTick = snapshot.state.tick;
+        snapshots += snapshot.sequence != lastSequence;
+        lastSequence = snapshot.sequence;
+        frames++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    thread->stop();
+    std::cout << "nit simulacije: " << sim.state.tick << " koraka za 1 s (" << (sim.state.tick * (double)SIMULATION_DT)
+        << " s simulacije), " << snapshots << " novih snimaka u " << frames << " frejmova, najsporije citanje "
+        << (worstRead * 1e6) << " us, " << (monotonic ? "vreme raste" : "GRESKA: vreme unazad")
+        << ", putnika posle 5 klikova: " << sim.state.passengers << ", prijavljenih dolazaka " << arrivalEvents << std::endl;
+    delete thread;
+}
+
+// ========== RED VOZNJE ==========
+static void benchTimetable() {
+    const long long DAY_TICKS = (long long)(86400.0f / SIMULATION_DT);
+    const int BUSES = 1000;
+    const int QUERIES = 10000000;
+
+    Station stations[NUM_STATIONS];
+    makeBenchStations(stations);
+    RouteGeometry route;
+    route.build(stations, NUM_STATIONS);
+
+    // Tacnost: predvidjanja za jedan autobus moraju da se poklope sa Simulation tik po tik, ceo dan
+    Timetable timetable;
+    timetable.build(route);
+    timetable.addBus();
+    Simulation sim(5);
+    long long arrivals = 0, arrivalMisses = 0, positionMisses = 0;
+    uint64_t previousArrival = 0;
+    for (long long t = 0; t < DAY_TICKS; t++) {
+        unsigned events = sim.step(SIMULATION_DT);
+        const SimulationState& st = sim.state;
+        if (events & EVENT_BUS_ARRIVED) {
+            arrivals++;
+            arrivalMisses += timetable.nextArrival(st.currentStation, previousArrival + 1) != st.tick;
+            previousArrival = st.tick;
+        }
+        BusPosition p = timetable.busPosition(0, st.tick);
+        // Na stanici Simulation zadrzava busProgress = 1, red voznje vraca 0
+        positionMisses += p.atStation != st.busAtStation || p.segment != st.currentStation
+            || (!p.atStation && fabs(p.progress - st.busProgress) > 1e-3f);
+    }
+    std::cout << "red voznje: krug " << timetable.cycleTicks << " tikova, " << arrivals << " dolazaka za dan, promasaja: dolazak "
+        << arrivalMisses << ", pozicija " << positionMisses << std::endl;
+
+    // Brzina upita za flotu, kao sto bi ih slali displeji na stanicama
+    Timetable fleetTable;
+    fleetTable.build(route);
+    for (int b = 0; b < BUSES; b++) {
+        fleetTable.addBus(randomBits(11, b, 0, 0));
+    }
+    std::vector<uint32_t> randomWords(QUERIES);
+    randomFillBits(12, 0, 0, randomWords.data(), QUERIES);
+
+    uint64_t checksum = 0;
+    auto start = BenchClock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        int bus;
+        checksum += fleetTable.nextArrival(randomWords[q] % NUM_STATIONS, randomWords[q] >> 4, &bus) + bus;
+    }
+    double arrivalSeconds = secondsSince(start);
+
+    float progressSum = 0.0f;
+    start = BenchClock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        BusPosition p = fleetTable.busPosition(randomWords[q] % BUSES, randomWords[q] >> 4);
+        progressSum += p.progress + p.segment;
+    }
+    double positionSeconds = secondsSince(start);
+
+    // Inkrementalno: jedan autobus javi svoje stanje, ostali se ne diraju
+    const int SYNCS = 1000000;
+    start = BenchClock::now();
+    for (int q = 0; q < SYNCS; q++) {
+        uint32_t w = randomWords[q];
+        fleetTable.syncBus(w % BUSES, (w >> 10) % NUM_STATIONS, (w & 1) != 0, (w >> 20) * 1e-4f, (w >> 22) * 1e-3f, q);
+    }
+    double syncSeconds = secondsSince(start);
+    bool sorted = std::is_sorted(fleetTable.sortedOrigins.begin(), fleetTable.sortedOrigins.end());
+
+    std::cout << BUSES << " autobusa: sledeci dolazak " << (arrivalSeconds / QUERIES * 1e9) << " ns/upit, pozicija "
+        << (positionSeconds / QUERIES * 1e9) << " ns/upit, azuriranje " << (syncSeconds / SYNCS * 1e9) << " ns, "
+        << (sorted ? "indeks sortiran" : "GRESKA: indeks nije sortiran") << " (" << (checksum + (uint64_t)progressSum) % 10 << ")" << std::endl;
+}
+
+// ========== FIKSNA RUTA ==========
+static void benchKioskRoute() {
+    const int ROUNDS = 2000;
+    const KioskRouteData& kiosk = kioskRoute();
+
+    // Kontrolne tacke (sin, sqrt) i tabele luka, kao pri pokretanju bez fiksne rute
+    double checksum = 0.0;
+    auto start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        RouteGeometry route;
+        route.build(kiosk.stations, NUM_STATIONS);
+        checksum += route.segments[r % NUM_STATIONS].length;
+    }
+    double runtimeSeconds = secondsSince(start);
+
+    // Gotove kontrolne tacke; ostaju samo tabele luka za kretanje autobusa
+    start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        RouteGeometry route;
+        route.build(kiosk.stations, kiosk.controlPoints, NUM_STATIONS);
+        checksum += route.segments[r % NUM_STATIONS].length;
+    }
+    double kioskSeconds = secondsSince(start);
+
+    RouteGeometry runtime;
+    runtime.build(kiosk.stations, NUM_STATIONS);
+    bool same = true;
+    float length = 0.0f;
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        length += runtime.segments[i].length;
+        same &= runtime.segments[i].p1.x == kiosk.controlPoints[i].x && runtime.segments[i].p1.y == kiosk.controlPoints[i].y;
+    }
+
+    std::cout << "pokretanje rute: racunanje " << (runtimeSeconds / ROUNDS * 1e6) << " us, constexpr podaci "
+        << (kioskSeconds / ROUNDS * 1e6) << " us, kontrolne tacke " << (same ? "iste" : "RAZLICITE")
+        << ", duzina " << length << " (" << (checksum > 0.0 ? "+" : "-") << ")" << std::endl;
+}
+
+// ========== SABLONI KRIVIH ==========
+// Stari nacin za mesovite krive: stepen se zna tek u toku rada, tacka se racuna petljom (de Casteljau)
+struct RuntimeCurve {
+    int degree;
+    int segments;
+    Vec2 points[4];
+};
+
+static Vec2 evaluateRuntime(const RuntimeCurve& c, float t) {
+    Vec2 work[4];
+    for (int i = 0; i <= c.degree; i++) work[i] = c.points[i];
+    for (int level = c.degree; level > 0; level--) {
+        for (int i = 0; i < level; i++) work[i] = lerp(work[i], work[i + 1], t);
+    }
+    return work[0];
+}
+
+static void benchCurves() {
+    const int ROUNDS = 200000;
+    typedef CurveRoute<LinearCurve<1>, RouteCurve, CubicCurve<40>, RouteCurve, LinearCurve<1>, CubicCurve<40> > MixedRoute;
+
+    MixedRoute route;
+    std::get<0>(route.curves) = LinearCurve<1>{ { Vec2(-0.8f, -0.2f), Vec2(-0.6f, 0.1f) } };
+    std::get<1>(route.curves) = RouteCurve{ { Vec2(-0.6f, 0.1f), Vec2(-0.4f, 0.6f), Vec2(-0.1f, 0.4f) } };
+    std::get<2>(route.curves) = CubicCurve<40>{ { Vec2(-0.1f, 0.4f), Vec2(0.1f, 0.8f), Vec2(0.4f, -0.2f), Vec2(0.6f, 0.2f) } };
+    std::get<3>(route.curves) = RouteCurve{ { Vec2(0.6f, 0.2f), Vec2(0.9f, 0.0f), Vec2(0.7f, -0.4f) } };
+    std::get<4>(route.curves) = LinearCurve<1>{ { Vec2(0.7f, -0.4f), Vec2(0.0f, -0.6f) } };
+    std::get<5>(route.curves) = CubicCurve<40>{ { Vec2(0.0f, -0.6f), Vec2(-0.3f, -0.9f), Vec2(-0.9f, -0.6f), Vec2(-0.8f, -0.2f) } };
+
+    RuntimeCurve runtime[MixedRoute::CURVE_COUNT] = {
+        { 1, 1, { std::get<0>(route.curves).points[0], std::get<0>(route.curves).points[1] } },
+        { 2, 30, { std::get<1>(route.curves).points[0], std::get<1>(route.curves).points[1], std::get<1>(route.curves).points[2] } },
+        { 3, 40, { std::get<2>(route.curves).points[0], std::get<2>(route.curves).points[1], std::get<2>(route.curves).points[2], std::get<2>(route.curves).points[3] } },
+        { 2, 30, { std::get<3>(route.curves).points[0], std::get<3>(route.curves).points[1], std::get<3>(route.curves).points[2] } },
+        { 1, 1, { std::get<4>(route.curves).points[0], std::get<4>(route.curves).points[1] } },
+        { 3, 40, { std::get<5>(route.curves).points[0], std::get<5>(route.curves).points[1], std::get<5>(route.curves).points[2], std::get<5>(route.curves).points[3] } }
+    };
+
+    std::vector<float> templated(MixedRoute::TOTAL_FLOATS), generic(MixedRoute::TOTAL_FLOATS);
+    double checksum = 0.0;
+    auto start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        std::get<1>(route.curves).points[1].x = -0.4f + r * 1e-7f;
+        route.tessellate(templated.data());
+        checksum += templated[r % MixedRoute::TOTAL_FLOATS];
+    }
+    double templateSeconds = secondsSince(start);
+
+    start = BenchClock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        runtime[1].points[1].x = -0.4f + r * 1e-7f;
+        float* out = generic.data();
+        for (int c = 0; c < MixedRoute::CURVE_COUNT; c++) {
+            for (int j = 0; j <= runtime[c].segments; j++) {
+                Vec2 point = evaluateRuntime(runtime[c], (float)j / (float)runtime[c].segments);
+                *out++ = point.x;
+                *out++ = point.y;
+            }
+        }
+        checksum += generic[r % MixedRoute::TOTAL_FLOATS];
+    }
+    double genericSeconds = secondsSince(start);
+
+    float maxDiff = 0.0f;
+    for (int i = 0; i < MixedRoute::TOTAL_FLOATS; i++) {
+        maxDiff = fmax(maxDiff, fabs(templated[i] - generic[i]));
+    }
+    DrawRange cubic = MixedRoute::drawRange(5);
+    std::cout << "mesovita ruta (" << MixedRoute::TOTAL_VERTICES << " tacaka, poslednja kriva " << cubic.first << "+" << cubic.count
+        << "): sablon " << (templateSeconds / ROUNDS * 1e9) << " ns, stepen u toku rada " << (genericSeconds / ROUNDS * 1e9)
+        << " ns po teselaciji, najveca razlika " << maxDiff << " (" << (checksum != 0.0 ? "+" : "-") << ")" << std::endl;
+}
+
+// ========== PRILAGODJENA TESELACIJA ==========
+// Najveca udaljenost tacaka krive od izlomljene linije, gusto uzorkovano, u pikselima
+static float polylineErrorPixels(const RouteSegment& seg, const float* vertices, DrawRange range, float pixelsPerUnit) {
+    const int SAMPLES = 16;
+    int n = range.count - 1;
+    float worst = 0.0f;
+    for (int j = 0; j < n; j++) {
+        Vec2 a(vertices[(range.first + j) * 2], vertices[(range.first + j) * 2 + 1]);
+        Vec2 b(vertices[(range.first + j + 1) * 2], vertices[(range.first + j + 1) * 2 + 1]);
+        for (int k = 1; k < SAMPLES; k++) {
+            float local = (float)k / SAMPLES;
+            Vec2 c = bezierQuadratic(seg.p0, seg.p1, seg.p2, (j + local) / n);
+            Vec2 l = lerp(a, b, local);
+            float dx = c.x - l.x, dy = c.y - l.y;
+            worst = fmax(worst, sqrt(dx * dx + dy * dy) * pixelsPerUnit);
+        }
+    }
+    return worst;
+}
+
+static void benchTessellation() {
+    // Gradska mreza: 10000 segmenata, vecina skoro pravih ulica, kraci delovi i poneka jaka krivina
+    const int SEGMENTS = 10000;
+    const float PIXELS_PER_UNIT = 960.0f;   // 1920 piksela za NDC [-1, 1]
+
+    std::vector<Station> stations(SEGMENTS);
+    std::vector<Vec2> controlPoints(SEGMENTS);
+    Vec2 position(-0.9f, -0.9f);
+    for (int i = 0; i < SEGMENTS; i++) {
+        stations[i].position = position;
+        stations[i].number = i;
+        float step = 0.002f + 0.02f * randomUniform(21, i, 0);
+        float angle = 6.2832f * randomUniform(21, i, 1);
+        position = Vec2(position.x + step * cos(angle), position.y + step * sin(angle));
+        if (position.x > 0.9f || position.x < -0.9f) position.x = -position.x * 0.5f;
+        if (position.y > 0.9f || position.y < -0.9f) position.y = -position.y * 0.5f;
+    }
+    for (int i = 0; i < SEGMENTS; i++) {
+        Vec2 p0 = stations[i].position, p2 = stations[(i + 1) % SEGMENTS].position;
+        // 90% ulica je skoro pravo (kontrolna tacka blizu sredine), 10% ima jaku krivinu
+        float bend = randomUniform(21, i, 2) < 0.9f ? 0.02f : 0.5f;
+        Vec2 mid((p0.x + p2.x) * 0.5f, (p0.y + p2.y) * 0.5f);
+        controlPoints[i] = Vec2(mid.x - (p2.y - p0.y) * bend, mid.y + (p2.x - p0.x) * bend);
+    }
+    RouteGeometry route;
+    route.build(stations.data(), controlPoints.data(), SEGMENTS);
+
+    AdaptivePath path;
+    auto start = BenchClock::now();
+    path.rebuild(route, PIXELS_PER_UNIT);
+    double buildSeconds = secondsSince(start);
+
+    float worst = 0.0f;
+    for (int i = 0; i < SEGMENTS; i++) {
+        worst = fmax(worst, polylineErrorPixels(route.segments[i], path.vertices.data(), path.ranges[i], PIXELS_PER_UNIT));
+    }
+
+    // Ponovna teselacija samo za znacajnu promenu razmere
+    int rebuilds = 0;
+    for (int frame = 0; frame < 600; frame++) {
+        float zoom = 1.0f + 3.0f * frame / 600.0f;
+        rebuilds += path.update(route, PIXELS_PER_UNIT * zoom);
+    }
+
+    long long uniform = (long long)SEGMENTS * RouteCurve::VERTICES;
+    std::cout << "teselacija: " << uniform << " tacaka ravnomerno, " << path.vertexCount() << " prilagodjeno ("
+        << ((double)uniform / path.vertexCount()) << "x manje) za " << (buildSeconds * 1e3) << " ms" << std::endl;
+    std::cout << "najvece odstupanje " << worst << " px (tolerancija " << PATH_TOLERANCE_PIXELS << "), zoom 1x-4x u 600 frejmova: "
+        << rebuilds << " ponovnih teselacija" << std::endl;
+}
+
+// Velicine slika iz Resource Files/Textures, redom kao AssetId (autobus, stanica, kontrola, vrata, autor, dve labele, 10 cifara)
+const int BENCH_ASSETS = 18;
+static void makeBenchAssetSizes(int* widths, int* heights) {
+    const int FIXED_WIDTHS[8] = { 80, 60, 50, 50, 50, 200, 256, 256 };
+    const int FIXED_HEIGHTS[8] = { 40, 60, 50, 70, 70, 60, 128, 128 };
+    for (int i = 0; i < BENCH_ASSETS; i++) {
+        widths[i] = i < 8 ? FIXED_WIDTHS[i] : 30;
+        heights[i] = i < 8 ? FIXED_HEIGHTS[i] : 30;
+    }
+}
+
+static void benchSprites() {
+    // Okvir kao u main (brojevi stanica, autobus, HUD) i velika mapa sa 16 tekstura izmesanih po redosledu
+    const int MAP_SPRITES = 20000;
+    const int MAP_TEXTURES = 16;
+    const int FRAMES = 200;
+
+    // Kao u main (drawAsset): svaki sprajt dobija teksturu stranice atlasa u kojoj je njegova slika
+    int widths[BENCH_ASSETS], heights[BENCH_ASSETS];
+    makeBenchAssetSizes(widths, heights);
+    AtlasPlacement placements[BENCH_ASSETS];
+    packAtlas(widths, heights, BENCH_ASSETS, 512, 512, 2, placements);
+    const int DIGIT_0 = 8;
+
+    SpriteList hud;
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        hud.add(1 + placements[DIGIT_0 + i % 10].page, 0.1f * i, 0.0f, 0.05f, 0.06f, 1.0f);
+    }
+    hud.add(1 + placements[0].page, 0.0f, 0.0f, 0.15f, 0.08f, 1.0f, UV_FULL, SPRITE_LAYER_VEHICLES);
+    // Vrata, labela putnika, dve cifre, labela kazni, dve cifre, autor, kontrola
+    const int HUD_ASSETS[] = { 3, 6, DIGIT_0 + 4, DIGIT_0 + 7, 7, DIGIT_0, DIGIT_0 + 3, 5, 2 };
+    for (int i = 0; i < 9; i++) {
+        hud.add(1 + placements[HUD_ASSETS[i]].page, 0.0f, 0.0f, 0.1f, 0.1f, 1.0f, UV_FULL, SPRITE_LAYER_HUD);
+    }
+    hud.build();
+
+    SpriteList map;
+    auto start = BenchClock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        map.clear();
+        for (int i = 0; i < MAP_SPRITES; i++) {
+            unsigned int texture = 1 + randomBits(31, i, 0) % MAP_TEXTURES;
+            map.add(texture, randomUniform(31, i, 1), randomUniform(31, i, 2), 0.01f, 0.01f, 1.0f);
+        }
+        map.build();
+    }
+    double seconds = secondsSince(start);
+
+    std::cout << "HUD iz atlasa: " << hud.size() << " sprajtova, " << hud.runs.size() << " poziva crtanja umesto " << hud.size()
+        << (hud.runs.size() <= 2 ? "" : " (GRESKA: ocekivano najvise 2)") << std::endl;
+    std::cout << "mapa: " << MAP_SPRITES << " sprajtova, " << map.runs.size() << " poziva crtanja, "
+        << (seconds * 1e3 / FRAMES) << " ms po frejmu (sortiranje + temena)" << std::endl;
+}
+
+static bool placementsOverlap(const int* w, const int* h, const AtlasPlacement* p, int count, int padding) {
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            if (p[i].page != p[j].page) continue;
+            bool apartX = p[i].x + w[i] + padding <= p[j].x - padding || p[j].x + w[j] + padding <= p[i].x - padding;
+            bool apartY = p[i].y + h[i] + padding <= p[j].y - padding || p[j].y + h[j] + padding <= p[i].y - padding;
+            if (!apartX && !apartY) return true;
+        }
+    }
+    return false;
+}
+
+static void benchAtlas() {
+    int widths[BENCH_ASSETS], heights[BENCH_ASSETS];
+    makeBenchAssetSizes(widths, heights);
+    AtlasPlacement placements[BENCH_ASSETS];
+    std::vector<SkylinePacker> pages;
+    int pageCount = packAtlas(widths, heights, BENCH_ASSETS, 512, 512, 2, placements, &pages);
+    std::cout << "teksture: 18 slika u " << pageCount << " stranica 512x512, popunjenost " << (pages[0].occupancy() * 100.0f)
+        << "%, preklapanja: " << (placementsOverlap(widths, heights, placements, BENCH_ASSETS, 2) ? "DA" : "ne") << std::endl;
+
+    // Vise ikonica razlicitih velicina, da se vidi ponasanje kad treba vise stranica
+    const int COUNT = 2000;
+    std::vector<int> w(COUNT), h(COUNT);
+    for (int i = 0; i < COUNT; i++) {
+        w[i] = 8 + randomInt(41, i, 0, 120);
+        h[i] = 8 + randomInt(41, i, 1, 120);
+    }
+    std::vector<AtlasPlacement> p(COUNT);
+    auto start = BenchClock::now();
+    pageCount = packAtlas(w.data(), h.data(), COUNT, 1024, 1024, 2, p.data(), &pages);
+    double seconds = secondsSince(start);
+    float occupancy = 0.0f;
+    for (int i = 0; i < pageCount; i++) {
+        occupancy += pages[i].occupancy();
+    }
+    std::cout << COUNT << " pravougaonika: " << pageCount << " stranica 1024x1024, prosecna popunjenost "
+        << (occupancy / pageCount * 100.0f) << "%, " << (seconds * 1e3) << " ms, preklapanja: "
+        << (placementsOverlap(w.data(), h.data(), p.data(), COUNT, 2) ? "DA" : "ne") << std::endl;
+}
+
+static void benchNetwork() {
+    // Mreza od 200 linija po 50 segmenata; svaka linija je zatvoren krug oko svog centra
+    const int LINES = 200;
+    const int SEGMENTS_PER_LINE = 50;
+    const int SEGMENTS = LINES * SEGMENTS_PER_LINE;
+
+    std::vector<Station> stations(SEGMENTS);
+    std::vector<Vec2> controlPoints(SEGMENTS);
+    std::vector<NetworkLine> lines(LINES);
+    std::vector<Vec2> centers(LINES);
+    for (int l = 0; l < LINES; l++) {
+        Vec2 center(randomUniform(23, l, 0) * 1.6f - 0.8f, randomUniform(23, l, 1) * 1.6f - 0.8f);
+        float radius = 0.05f + 0.15f * randomUniform(23, l, 2);
+        centers[l] = center;
+        for (int i = 0; i < SEGMENTS_PER_LINE; i++) {
+            float angle = 6.2832f * i / SEGMENTS_PER_LINE;
+            stations[l * SEGMENTS_PER_LINE + i].position = Vec2(center.x + radius * cos(angle), center.y + radius * sin(angle));
+            stations[l * SEGMENTS_PER_LINE + i].number = i;
+        }
+        lines[l].firstSegment = l * SEGMENTS_PER_LINE;
+        lines[l].segmentCount = SEGMENTS_PER_LINE;
+        lines[l].closed = true;
+    }
+    // Kontrolna tacka je malo izvan sredine tetive, pa je svaki segment luk kruga
+    for (int l = 0; l < LINES; l++) {
+        for (int i = 0; i < SEGMENTS_PER_LINE; i++) {
+            const Station& a = stations[l * SEGMENTS_PER_LINE + i];
+            const Station& b = stations[l * SEGMENTS_PER_LINE + (i + 1) % SEGMENTS_PER_LINE];
+            Vec2 mid((a.position.x + b.position.x) * 0.5f, (a.position.y + b.position.y) * 0.5f);
+            controlPoints[l * SEGMENTS_PER_LINE + i] = Vec2(mid.x + (mid.x - centers[l].x) * 0.01f, mid.y + (mid.y - centers[l].y) * 0.01f);
+        }
+    }
+    RouteGeometry route;
+    route.build(stations.data(), controlPoints.data(), SEGMENTS);
+    // RouteGeometry vezuje poslednji segment linije za prvu stanicu sledece; ovde se zatvara na svoju
+    for (int l = 0; l < LINES; l++) {
+        int last = l * SEGMENTS_PER_LINE + SEGMENTS_PER_LINE - 1;
+        route.segments[last].p2 = stations[l * SEGMENTS_PER_LINE].position;
+    }
+    AdaptivePath path;
+    path.rebuild(route, 960.0f);
+
+    NetworkPolyline polyline;
+    const int BUILDS = 100;
+    auto start = BenchClock::now();
+    for (int i = 0; i < BUILDS; i++) {
+        polyline.build(path, lines.data(), LINES);
+    }
+    double seconds = secondsSince(start);
+
+    int restarts = 0;
+    for (size_t i = 0; i < polyline.indices.size(); i++) {
+        restarts += polyline.indices[i] == NETWORK_RESTART_INDEX;
+    }
+    std::cout << "mreza: " << LINES << " linija, " << SEGMENTS << " segmenata: 1 poziv crtanja umesto " << SEGMENTS
+        << ", " << restarts << " prekida" << std::endl;
+    std::cout << "temena: " << path.vertexCount() << " -> " << polyline.vertices.size() << " (zajednicke tacke jednom), "
+        << polyline.indexCount() << " indeksa, " << (seconds * 1e3 / BUILDS) << " ms po izgradnji" << std::endl;
+}
+
+// ========== REGISTAR ==========
+struct BenchmarkEntry {
+    const char* name;
+    void (*run)();
+};
+
+static const BenchmarkEntry BENCHMARKS[] = {
+    { "simulation", benchSimulation },
+    { "fleet", benchFleet },
+    { "route", benchRoutePositions },
+    { "bezier", benchBezierBatch },
+    { "events", benchEventSimulation },
+    { "random", benchRandom },
+    { "montecarlo", benchMonteCarlo },
+    { "passengers", benchPassengers },
+    { "snapshot", benchSnapshot },
+    { "journal", benchJournal },
+    { "timewarp", benchTimeWarp },
+    { "inputqueue", benchInputQueue },
+    { "simthread", benchSimulationThread },
+    { "timetable", benchTimetable },
+    { "kiosk", benchKioskRoute },
+    { "curves", benchCurves },
+    { "tessellation", benchTessellation },
+    { "sprites", benchSprites },
+    { "atlas", benchAtlas },
+    { "network", benchNetwork },
+};
+
+int runBenchmarks(int argc, char** argv) {
+    int count = sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]);
+    int executed = 0;
+
+    for (int i = 0; i < count; i++) {
+        bool selected = (argc == 0);
+        for (int j = 0; j < argc; j++) {
+            if (strcmp(argv[j], BENCHMARKS[i].name) == 0) {
+                selected = true;
+            }
+        }
+        if (selected) {
+            std::cout << "\n=== BENCHMARK: " << BENCHMARKS[i].name << " ===" << std::endl;
+            BENCHMARKS[i].run();
+            executed++;
+        }
+    }
+
+    if (executed == 0) {
+        std::cout << "Nepoznat benchmark. Dostupni:";
+        for (int i = 0; i < count; i++) {
+            std::cout << " " << BENCHMARKS[i].name;
+        }
+        std::cout << std::endl;
+        return -1;
+    }
+    return 0;
+}
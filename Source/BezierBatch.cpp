@@ -0,0 +1,191 @@
+#include "../Header/BezierBatch.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define BEZIER_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define BEZIER_TARGET_AVX2
+#else
+#define BEZIER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// ========== SKALARNI KERNELI ==========
+static void batchScalar(Vec2 p0, Vec2 p1, Vec2 p2, const float* t, float* outX, float* outY, int begin, int count) {
+    for (int i = begin; i < count; i++) {
+        Vec2 point = bezierQuadratic(p0, p1, p2, t[i]);
+        outX[i] = point.x;
+        outY[i] = point.y;
+    }
+}
+
+static void indexedScalar(const BezierCurves& c, const int* idx, const float* t, float* outX, float* outY, int begin, int count) {
+    for (int i = begin; i < count; i++) {
+        int k = idx[i];
+        Vec2 point = bezierQuadratic(Vec2(c.p0x[k], c.p0y[k]), Vec2(c.p1x[k], c.p1y[k]), Vec2(c.p2x[k], c.p2y[k]), t[i]);
+        outX[i] = point.x;
+        outY[i] = point.y;
+    }
+}
+
+#ifdef BEZIER_X86
+// ========== SSE ==========
+// Isti redosled kao u bezierQuadratic: (u*u*p0 + 2*u*t*p1) + t*t*p2
+static inline void evalSse(__m128 t, __m128 p0x, __m128 p0y, __m128 p1x, __m128 p1y, __m128 p2x, __m128 p2y, float* outX, float* outY) {
+    __m128 u = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+    __m128 a = _mm_mul_ps(u, u);
+    __m128 b = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), u), t);
+    __m128 c = _mm_mul_ps(t, t);
+    __m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, p0x), _mm_mul_ps(b, p1x)), _mm_mul_ps(c, p2x));
+    __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, p0y), _mm_mul_ps(b, p1y)), _mm_mul_ps(c, p2y));
+    _mm_storeu_ps(outX, x);
+    _mm_storeu_ps(outY, y);
+}
+
+static void batchSse(Vec2 p0, Vec2 p1, Vec2 p2, const float* t, float* outX, float* outY, int count) {
+    __m128 p0x = _mm_set1_ps(p0.x), p0y = _mm_set1_ps(p0.y);
+    __m128 p1x = _mm_set1_ps(p1.x), p1y = _mm_set1_ps(p1.y);
+    __m128 p2x = _mm_set1_ps(p2.x), p2y = _mm_set1_ps(p2.y);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        evalSse(_mm_loadu_ps(t + i), p0x, p0y, p1x, p1y, p2x, p2y, outX + i, outY + i);
+    }
+    batchScalar(p0, p1, p2, t, outX, outY, i, count);
+}
+
+static void indexedSse(const BezierCurves& c, const int* idx, const float* t, float* outX, float* outY, int count) {
+    const float* p0x = c.p0x.data(); const float* p0y = c.p0y.data();
+    const float* p1x = c.p1x.data(); const float* p1y = c.p1y.data();
+    const float* p2x = c.p2x.data(); const float* p2y = c.p2y.data();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int k0 = idx[i], k1 = idx[i + 1], k2 = idx[i + 2], k3 = idx[i + 3];
+        evalSse(_mm_loadu_ps(t + i),
+            _mm_setr_ps(p0x[k0], p0x[k1], p0x[k2], p0x[k3]), _mm_setr_ps(p0y[k0], p0y[k1], p0y[k2], p0y[k3]),
+            _mm_setr_ps(p1x[k0], p1x[k1], p1x[k2], p1x[k3]), _mm_setr_ps(p1y[k0], p1y[k1], p1y[k2], p1y[k3]),
+            _mm_setr_ps(p2x[k0], p2x[k1], p2x[k2], p2x[k3]), _mm_setr_ps(p2y[k0], p2y[k1], p2y[k2], p2y[k3]),
+            outX + i, outY + i);
+    }
+    indexedScalar(c, idx, t, outX, outY, i, count);
+}
+
+// ========== AVX2 ==========
+BEZIER_TARGET_AVX2
+static inline void evalAvx(__m256 t, __m256 p0x, __m256 p0y, __m256 p1x, __m256 p1y, __m256 p2x, __m256 p2y, float* outX, float* outY) {
+    __m256 u = _mm256_sub_ps(_mm256_set1_ps(1.0f), t);
+    __m256 a = _mm256_mul_ps(u, u);
+    __m256 b = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), u), t);
+    __m256 c = _mm256_mul_ps(t, t);
+    __m256 x = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, p0x), _mm256_mul_ps(b, p1x)), _mm256_mul_ps(c, p2x));
+    __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, p0y), _mm256_mul_ps(b, p1y)), _mm256_mul_ps(c, p2y));
+    _mm256_storeu_ps(outX, x);
+    _mm256_storeu_ps(outY, y);
+}
+
+BEZIER_TARGET_AVX2
+static void batchAvx2(Vec2 p0, Vec2 p1, Vec2 p2, const float* t, float* outX, float* outY, int count) {
+    __m256 p0x = _mm256_set1_ps(p0.x), p0y = _mm256_set1_ps(p0.y);
+    __m256 p1x = _mm256_set1_ps(p1.x), p1y = _mm256_set1_ps(p1.y);
+    __m256 p2x = _mm256_set1_ps(p2.x), p2y = _mm256_set1_ps(p2.y);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        evalAvx(_mm256_loadu_ps(t + i), p0x, p0y, p1x, p1y, p2x, p2y, outX + i, outY + i);
+    }
+    batchScalar(p0, p1, p2, t, outX, outY, i, count);
+}
+
+BEZIER_TARGET_AVX2
+static void indexedAvx2(const BezierCurves& c, const int* idx, const float* t, float* outX, float* outY, int count) {
+    // AVX2 gather cita kontrolne tacke za 8 autobusa jednom instrukcijom po koordinati
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i k = _mm256_loadu_si256((const __m256i*)(idx + i));
+        evalAvx(_mm256_loadu_ps(t + i),
+            _mm256_i32gather_ps(c.p0x.data(), k, 4), _mm256_i32gather_ps(c.p0y.data(), k, 4),
+            _mm256_i32gather_ps(c.p1x.data(), k, 4), _mm256_i32gather_ps(c.p1y.data(), k, 4),
+            _mm256_i32gather_ps(c.p2x.data(), k, 4), _mm256_i32gather_ps(c.p2y.data(), k, 4),
+            outX + i, outY + i);
+    }
+    indexedScalar(c, idx, t, outX, outY, i, count);
+}
+
+static bool cpuHasAvx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    // AVX mora da podrzava i operativni sistem (cuvanje YMM registara)
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+// ========== IZBOR KERNELA ==========
+static BezierKernel activeKernel = BEZIER_KERNEL_SCALAR;
+static bool kernelChosen = false;
+
+BezierKernel bezierBestKernel() {
+#ifdef BEZIER_X86
+    return cpuHasAvx2() ? BEZIER_KERNEL_AVX2 : BEZIER_KERNEL_SSE;
+#else
+    return BEZIER_KERNEL_SCALAR;
+#endif
+}
+
+BezierKernel bezierActiveKernel() {
+    if (!kernelChosen) {
+        activeKernel = bezierBestKernel();
+        kernelChosen = true;
+    }
+    return activeKernel;
+}
+
+bool bezierSetKernel(BezierKernel kernel) {
+    if (kernel > bezierBestKernel()) {
+        return false;
+    }
+    activeKernel = kernel;
+    kernelChosen = true;
+    return true;
+}
+
+const char* bezierKernelName(BezierKernel kernel) {
+    switch (kernel) {
+    case BEZIER_KERNEL_SSE: return "SSE";
+    case BEZIER_KERNEL_AVX2: return "AVX2";
+    default: return "skalarni";
+    }
+}
+
+void bezierQuadraticBatch(Vec2 p0, Vec2 p1, Vec2 p2, const float* t, float* outX, float* outY, int count) {
+    switch (bezierActiveKernel()) {
+#ifdef BEZIER_X86
+    case BEZIER_KERNEL_AVX2: batchAvx2(p0, p1, p2, t, outX, outY, count); return;
+    case BEZIER_KERNEL_SSE: batchSse(p0, p1, p2, t, outX, outY, count); return;
+#endif
+    default: batchScalar(p0, p1, p2, t, outX, outY, 0, count); return;
+    }
+}
+
+void bezierQuadraticIndexed(const BezierCurves& curves, const int* curveIndex, const float* t, float* outX, float* outY, int count) {
+    switch (bezierActiveKernel()) {
+#ifdef BEZIER_X86
+    case BEZIER_KERNEL_AVX2: indexedAvx2(curves, curveIndex, t, outX, outY, count); return;
+    case BEZIER_KERNEL_SSE: indexedSse(curves, curveIndex, t, outX, outY, count); return;
+#endif
+    default: indexedScalar(curves, curveIndex, t, outX, outY, 0, count); return;
+    }
+}
@@ -0,0 +1,68 @@
+#include "../Header/EventSimulation.h"
+#include "../Header/Simulation.h"
+
+EventSimulation::EventSimulation() {
+    reset();
+}
+
+void EventSimulation::reset() {
+    queue = std::priority_queue<BusEvent, std::vector<BusEvent>, std::greater<BusEvent> >();
+    busStation.clear();
+    now = 0.0;
+    stats.departures = 0;
+    stats.arrivals = 0;
+    stats.arrivalsPerStation.assign(NUM_STATIONS, 0);
+}
+
+int EventSimulation::addBus(int station, double departureTime) {
+    int bus = (int)busStation.size();
+    busStation.push_back(station % NUM_STATIONS);
+
+    BusEvent event;
+    event.time = departureTime;
+    event.bus = bus;
+    event.station = station % NUM_STATIONS;
+    event.type = BUS_EVENT_DEPARTURE;
+    queue.push(event);
+    return bus;
+}
+
+bool EventSimulation::processNext(double endTime, BusEvent* processed) {
+    if (queue.empty() || queue.top().time > endTime) {
+        return false;
+    }
+
+    BusEvent event = queue.top();
+    queue.pop();
+    now = event.time;
+
+    // Svaki dogadjaj zakazuje tacno jedan sledeci, pa je red velik koliko i flota
+    BusEvent next;
+    next.bus = event.bus;
+    if (event.type == BUS_EVENT_DEPARTURE) {
+        stats.departures++;
+        next.type = BUS_EVENT_ARRIVAL;
+        next.station = (event.station + 1) % NUM_STATIONS;
+        next.time = event.time + 1.0 / BUS_SPEED;
+    }
+    else {
+        stats.arrivals++;
+        stats.arrivalsPerStation[event.station]++;
+        busStation[event.bus] = event.station;
+        next.type = BUS_EVENT_DEPARTURE;
+        next.station = event.station;
+        next.time = event.time + STATION_WAIT_TIME;
+    }
+    queue.push(next);
+
+    if (processed != 0) {
+        *processed = event;
+    }
+    return true;
+}
+
+void EventSimulation::runUntil(double endTime) {
+    while (processNext(endTime)) {
+    }
+    now = endTime;
+}
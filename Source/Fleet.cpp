@@ -0,0 +1,71 @@
+#include "../Header/Fleet.h"
+#include "../Header/Simulation.h"
+#include "../Header/Route.h"
+#include "../Header/BezierBatch.h"
+
+void Fleet::clear() {
+    progress.clear();
+    stationTimer.clear();
+    segment.clear();
+    flags.clear();
+}
+
+void Fleet::reserve(int count) {
+    progress.reserve(count);
+    stationTimer.reserve(count);
+    segment.reserve(count);
+    flags.reserve(count);
+}
+
+int Fleet::addBus(int station, float timer) {
+    progress.push_back(0.0f);
+    stationTimer.push_back(timer);
+    segment.push_back(station % NUM_STATIONS);
+    flags.push_back(FLEET_AT_STATION);
+    return size() - 1;
+}
+
+int Fleet::step(float dt) {
+    int count = size();
+    float* __restrict prog = progress.data();
+    float* __restrict timer = stationTimer.data();
+    int* __restrict seg = segment.data();
+    unsigned int* __restrict fl = flags.data();
+    float travel = BUS_SPEED * dt;
+    int arrivals = 0;
+
+    // Ista pravila kao Simulation::step, ali zapisana kao selekcije umesto grana
+    for (int i = 0; i < count; i++) {
+        // Maske su 0/1 i koriste se kao mnozioci, da kompajler ne bi ubacio skokove u petlju
+        int atStation = fl[i] & FLEET_AT_STATION;
+        float atMask = (float)atStation;
+        float t = timer[i] + dt * atMask;
+        float p = prog[i] + travel * (1.0f - atMask);
+
+        int depart = atStation & (int)(t >= STATION_WAIT_TIME);
+        int arrive = (atStation ^ 1) & (int)(p >= 1.0f);
+        int changed = depart | arrive;
+
+        timer[i] = t * (float)(changed ^ 1);
+        prog[i] = (p < 1.0f ? p : 1.0f) * (float)(depart ^ 1);
+
+        int nextSeg = seg[i] + arrive;
+        seg[i] = nextSeg - NUM_STATIONS * (int)(nextSeg >= NUM_STATIONS);
+        fl[i] = (unsigned int)((fl[i] & ~FLEET_AT_STATION) | (atStation ^ changed));
+        arrivals += arrive;
+    }
+
+    return arrivals;
+}
+
+void Fleet::computePositions(const RouteGeometry& route, float* params, float* outX, float* outY) const {
+    int count = size();
+
+    for (int i = 0; i < count; i++) {
+        // Segment se menja pri dolasku, pa je autobus na stanici uvek na pocetku svog segmenta
+        const ArcLengthTable& table = route.segments[segment[i]].table;
+        params[i] = (flags[i] & FLEET_AT_STATION) ? 0.0f : table.parameterAtFraction(progress[i]);
+    }
+
+    bezierQuadraticIndexed(route.curves, segment.data(), params, outX, outY, count);
+}
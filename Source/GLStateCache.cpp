@@ -0,0 +1,224 @@
+#include "../Header/GLStateCache.h"
+#include "../Header/Samplers.h"
+#include "../Header/Util.h"
+
+#include <cstring>
+#include <iostream>
+
+GLStateCache glState;
+
+static const char* CALL_NAMES[GL_CALL_KIND_COUNT] = {
+    "glUseProgram", "glBindVertexArray", "glActiveTexture", "glBindTexture", "glBindSampler", "glEnable/glDisable", "glBlendFunc", "glUniform*"
+};
+
+GLStateCache::GLStateCache() {
+    capabilities[0] = GL_BLEND;
+    capabilities[1] = GL_PRIMITIVE_RESTART;
+    currentUniforms = 0;
+    invalidate();
+    resetStats();
+}
+
+void GLStateCache::invalidate() {
+    program = GL_STATE_UNKNOWN;
+    vertexArray = GL_STATE_UNKNOWN;
+    activeUnit = GL_STATE_UNKNOWN;
+    for (int i = 0; i < GL_CACHE_TEXTURE_UNITS; i++) {
+        textures[i] = GL_STATE_UNKNOWN;
+        samplers[i] = GL_STATE_UNKNOWN;
+    }
+    capabilityState[0] = capabilityState[1] = GL_STATE_UNKNOWN;
+    blendSource = blendDestination = GL_STATE_UNKNOWN;
+    currentUniforms = 0;
+}
+
+void GLStateCache::resetStats() {
+    for (int i = 0; i < GL_CALL_KIND_COUNT; i++) {
+        stats.issued[i] = 0;
+        stats.elided[i] = 0;
+    }
+}
+
+void GLStateCache::forgetProgram(unsigned int id) {
+    for (size_t i = 0; i < uniforms.size(); i++) {
+        if (uniforms[i].program == id) {
+            uniforms.erase(uniforms.begin() + i);
+            break;
+        }
+    }
+    currentUniforms = 0;
+    if (program == id) {
+        program = GL_STATE_UNKNOWN;
+    }
+}
+
+bool GLStateCache::record(GLStateCall call, bool changed) {
+    if (changed) {
+        stats.issued[call]++;
+    }
+    else {
+        stats.elided[call]++;
+    }
+    return changed;
+}
+
+void GLStateCache::useProgram(unsigned int id) {
+    if (record(GL_CALL_PROGRAM, program != id)) {
+        glUseProgram(id);
+    }
+    if (program != id || currentUniforms == 0) {
+        program = id;
+        currentUniforms = 0;
+        for (size_t i = 0; i < uniforms.size(); i++) {
+            if (uniforms[i].program == id) {
+                currentUniforms = &uniforms[i];
+            }
+        }
+        if (currentUniforms == 0) {
+            ProgramUniforms entry;
+            entry.program = id;
+            uniforms.push_back(entry);
+            currentUniforms = &uniforms.back();
+        }
+    }
+}
+
+void GLStateCache::bindVertexArray(unsigned int id) {
+    if (record(GL_CALL_VERTEX_ARRAY, vertexArray != id)) {
+        glBindVertexArray(id);
+        vertexArray = id;
+    }
+}
+
+void GLStateCache::activeTexture(int unit) {
+    if (record(GL_CALL_ACTIVE_TEXTURE, activeUnit != (unsigned int)unit)) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        activeUnit = unit;
+    }
+}
+
+void GLStateCache::bindSampler(int unit, unsigned int sampler) {
+    // glBindSampler prima jedinicu direktno, pa ne zavisi od aktivne jedinice
+    if (record(GL_CALL_SAMPLER, samplers[unit] != sampler)) {
+        glBindSampler(unit, sampler);
+        samplers[unit] = sampler;
+    }
+}
+
+void GLStateCache::bindTexture(int unit, unsigned int texture) {
+    bindSampler(unit, samplerObject(textureSampler(texture)));
+    if (textures[unit] == texture) {
+        record(GL_CALL_TEXTURE, false);
+        return;
+    }
+    // Aktivna jedinica se menja samo kad stvarno treba vezati teksturu
+    activeTexture(unit);
+    record(GL_CALL_TEXTURE, true);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    textures[unit] = texture;
+}
+
+void GLStateCache::setEnabled(unsigned int capability, bool enabled) {
+    unsigned int wanted = enabled ? 1 : 0;
+    for (int i = 0; i < 2; i++) {
+        if (capabilities[i] != capability) {
+            continue;
+        }
+        if (record(GL_CALL_CAPABILITY, capabilityState[i] != wanted)) {
+            if (enabled) glEnable(capability);
+            else glDisable(capability);
+            capabilityState[i] = wanted;
+        }
+        return;
+    }
+    // Sposobnost koju kes ne prati uvek ide do drajvera
+    record(GL_CALL_CAPABILITY, true);
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+}
+
+void GLStateCache::blendFunc(unsigned int source, unsigned int destination) {
+    if (record(GL_CALL_BLEND_FUNC, blendSource != source || blendDestination != destination)) {
+        glBlendFunc(source, destination);
+        blendSource = source;
+        blendDestination = destination;
+    }
+}
+
+bool GLStateCache::uniformChanged(int location, const void* data, int words) {
+    if (location < 0) {
+        return false;
+    }
+    if (currentUniforms == 0) {
+        // Program nije postavljen kroz kes; vrednost se ne pamti
+        return record(GL_CALL_UNIFORM, true);
+    }
+    std::vector<UniformSlot>& slots = currentUniforms->slots;
+    if ((size_t)location >= slots.size()) {
+        UniformSlot empty;
+        empty.valid = false;
+        empty.words = 0;
+        slots.resize(location + 1, empty);
+    }
+    UniformSlot& slot = slots[location];
+    bool changed = !slot.valid || slot.words != words || memcmp(slot.bits, data, words * sizeof(unsigned int)) != 0;
+    if (changed) {
+        slot.valid = true;
+        slot.words = words;
+        memcpy(slot.bits, data, words * sizeof(unsigned int));
+    }
+    return record(GL_CALL_UNIFORM, changed);
+}
+
+void GLStateCache::uniform(int location, int value) {
+    if (uniformChanged(location, &value, 1)) {
+        glUniform1i(location, value);
+    }
+}
+
+void GLStateCache::uniform(int location, float value) {
+    if (uniformChanged(location, &value, 1)) {
+        glUniform1f(location, value);
+    }
+}
+
+void GLStateCache::uniform(int location, float x, float y, float z) {
+    float value[3] = { x, y, z };
+    if (uniformChanged(location, value, 3)) {
+        glUniform3f(location, x, y, z);
+    }
+}
+
+void GLStateCache::uniformMatrix(int location, const float* matrix4) {
+    if (uniformChanged(location, matrix4, 16)) {
+        glUniformMatrix4fv(location, 1, GL_FALSE, matrix4);
+    }
+}
+
+unsigned long long GLStateCache::totalIssued() const {
+    unsigned long long total = 0;
+    for (int i = 0; i < GL_CALL_KIND_COUNT; i++) total += stats.issued[i];
+    return total;
+}
+
+unsigned long long GLStateCache::totalElided() const {
+    unsigned long long total = 0;
+    for (int i = 0; i < GL_CALL_KIND_COUNT; i++) total += stats.elided[i];
+    return total;
+}
+
+void GLStateCache::printStats(unsigned long long frames) const {
+    unsigned long long issued = totalIssued(), elided = totalElided();
+    unsigned long long requested = issued + elided;
+    std::cout << "GL stanje: " << requested << " zahteva, " << issued << " poslato drajveru, " << elided << " preskoceno ("
+        << (requested > 0 ? 100.0 * elided / requested : 0.0) << "%)";
+    if (frames > 0) {
+        std::cout << ", " << (double)issued / frames << " poziva po frejmu";
+    }
+    std::cout << std::endl;
+    for (int i = 0; i < GL_CALL_KIND_COUNT; i++) {
+        if (stats.issued[i] + stats.elided[i] > 0) {
+            std::cout << "  " << CALL_NAMES[i] << ": " << stats.issued[i] << " poslato, " << stats.elided[i] << " preskoceno" << std::endl;
+        }
+    }
+}
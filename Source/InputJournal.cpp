@@ -0,0 +1,141 @@
+#include "../Header/InputJournal.h"
+
+#include <chrono>
+#include <fstream>
+
+struct JournalHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t seed;
+    uint32_t bus;
+    int32_t finalPassengers;
+    int32_t finalTotalFines;
+    uint32_t reserved;
+    uint64_t eventCount;
+    uint64_t byteCount;
+};
+
+// ========== VARINT ==========
+static void writeVarint(std::vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((unsigned char)value);
+}
+
+static bool readVarint(const std::vector<unsigned char>& in, size_t& pos, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+        unsigned char byte = in[pos++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ========== SNIMANJE ==========
+InputJournal::InputJournal() {
+    begin(0, 0);
+}
+
+void InputJournal::begin(uint64_t newSeed, uint32_t newBus) {
+    seed = newSeed;
+    bus = newBus;
+    bytes.clear();
+    lastTick = 0;
+    eventCount = 0;
+    finished = false;
+    finalPassengers = 0;
+    finalTotalFines = 0;
+}
+
+void InputJournal::record(uint64_t tick, SimulationInput input) {
+    writeVarint(bytes, ((tick - lastTick) << 2) | (uint64_t)input);
+    lastTick = tick;
+    eventCount++;
+}
+
+void InputJournal::finish(const SimulationState& state) {
+    writeVarint(bytes, ((state.tick - lastTick) << 2) | (uint64_t)JOURNAL_END);
+    lastTick = state.tick;
+    finished = true;
+    finalPassengers = state.passengers;
+    finalTotalFines = state.totalFines;
+}
+
+bool InputJournal::save(const char* path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    JournalHeader header = { JOURNAL_MAGIC, JOURNAL_VERSION, seed, bus, finalPassengers, finalTotalFines, 0, eventCount, bytes.size() };
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)bytes.data(), (std::streamsize)bytes.size());
+    return file.good();
+}
+
+bool InputJournal::load(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    JournalHeader header;
+    if (!file.read((char*)&header, sizeof(header)) || header.magic != JOURNAL_MAGIC || header.version != JOURNAL_VERSION) {
+        return false;
+    }
+    // Duzina iz zaglavlja se proverava prema ostatku fajla pre alokacije, da ostecen dnevnik ne trazi ogroman bafer
+    std::streamoff dataStart = file.tellg();
+    file.seekg(0, std::ios::end);
+    std::streamoff remaining = file.tellg() - dataStart;
+    if (dataStart < 0 || remaining < 0 || header.byteCount > (uint64_t)remaining) {
+        return false;
+    }
+    file.seekg(dataStart);
+    std::vector<unsigned char> loaded((size_t)header.byteCount);
+    if (!file.read((char*)loaded.data(), (std::streamsize)loaded.size())) {
+        return false;
+    }
+
+    // Postojeci dnevnik se menja tek kad je ucitavanje uspelo
+    begin(header.seed, header.bus);
+    bytes.swap(loaded);
+    eventCount = header.eventCount;
+    finalPassengers = header.finalPassengers;
+    finalTotalFines = header.finalTotalFines;
+    finished = true;
+    return true;
+}
+
+// ========== PONAVLJANJE ==========
+ReplayResult replayJournal(const InputJournal& journal) {
+    auto start = std::chrono::high_resolution_clock::now();
+    Simulation sim(journal.seed, journal.bus);
+    ReplayResult result;
+    result.events = 0;
+    result.matches = false;
+
+    size_t pos = 0;
+    uint64_t tick = 0;
+    uint64_t entry;
+    while (readVarint(journal.bytes, pos, entry)) {
+        tick += entry >> 2;
+        int kind = (int)(entry & 3);
+
+        // Ulaz je zapisan pre koraka u kojem je obradjen, pa se prvo stize do njegovog tika
+        while (sim.state.tick < tick) {
+            sim.step(SIMULATION_DT);
+        }
+        if (kind == JOURNAL_END) {
+            result.matches = sim.state.passengers == journal.finalPassengers && sim.state.totalFines == journal.finalTotalFines;
+            break;
+        }
+        sim.handleInput((SimulationInput)kind);
+        result.events++;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    result.ticks = sim.state.tick;
+    result.finalState = sim.state;
+    return result;
+}
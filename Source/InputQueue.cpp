@@ -0,0 +1,34 @@
+#include "../Header/InputQueue.h"
+
+InputQueue::InputQueue() {
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    dropped = 0;
+}
+
+bool InputQueue::push(double time, InputCommand command) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    // Brojaci rastu bez ogranicenja; razlika je broj dogadjaja u redu i kada se prelije
+    if (h - tail.load(std::memory_order_acquire) >= INPUT_QUEUE_CAPACITY) {
+        dropped++;
+        return false;
+    }
+    InputEvent& e = events[h & (INPUT_QUEUE_CAPACITY - 1)];
+    e.time = time;
+    e.command = (uint32_t)command;
+    // Release: potrosac koji vidi novi head vidi i upisan dogadjaj
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+uint32_t InputQueue::drain(InputEvent* out, uint32_t maxCount) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t available = head.load(std::memory_order_acquire) - t;
+    uint32_t count = available < maxCount ? available : maxCount;
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = events[(t + i) & (INPUT_QUEUE_CAPACITY - 1)];
+    }
+    // Jedan release za ceo paket oslobadja mesta proizvodjacu
+    tail.store(t + count, std::memory_order_release);
+    return count;
+}
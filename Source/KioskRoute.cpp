@@ -0,0 +1,59 @@
+#include "../Header/KioskRoute.h"
+#include "../Header/ConstexprMath.h"
+
+// ========== RUTA ==========
+// Iste stanice kao u initStations; ostalo je izvedeno iz njih po istim formulama kao u Route.cpp
+constexpr Vec2 KIOSK_STATIONS[NUM_STATIONS] = {
+    Vec2(-0.65f, 0.55f),   // Top-left area
+    Vec2(-0.25f, 0.65f),   // Top-center-left
+    Vec2(0.35f, 0.60f),    // Top-right area
+    Vec2(0.70f, 0.25f),    // Right side, upper
+    Vec2(0.75f, -0.15f),   // Right side, lower
+    Vec2(0.45f, -0.55f),   // Bottom-right
+    Vec2(0.0f, -0.65f),    // Bottom-center
+    Vec2(-0.50f, -0.50f),  // Bottom-left
+    Vec2(-0.75f, -0.10f),  // Left side, lower
+    Vec2(-0.70f, 0.20f)    // Left side, upper
+};
+
+// ========== CONSTEXPR VERZIJE FUNKCIJA IZ Route.cpp ==========
+constexpr Vec2 kioskControlPoint(Vec2 p0, Vec2 p2, int segment) {
+    float dirX = p2.x - p0.x;
+    float dirY = p2.y - p0.y;
+    float dist = (float)constexprSqrt(dirX * dirX + dirY * dirY);
+    float normalX = -dirY;
+    float normalY = dirX;
+    if (dist > 0.0001f) {
+        normalX /= dist;
+        normalY /= dist;
+    }
+
+    float curvature = 0.12f + 0.08f * (float)constexprSin(segment * 0.7f);
+    float curveDir = (segment % 3 == 0) ? -1.0f : 1.0f;
+    return Vec2(
+        (p0.x + p2.x) / 2.0f + normalX * curvature * curveDir,
+        (p0.y + p2.y) / 2.0f + normalY * curvature * curveDir
+    );
+}
+
+constexpr KioskRouteData buildKioskRoute() {
+    KioskRouteData route = {};
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        route.stations[i].position = KIOSK_STATIONS[i];
+        route.stations[i].number = i;
+    }
+
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        Vec2 p0 = KIOSK_STATIONS[i];
+        Vec2 p2 = KIOSK_STATIONS[(i + 1) % NUM_STATIONS];
+        route.controlPoints[i] = kioskControlPoint(p0, p2, i);
+    }
+    return route;
+}
+
+// constexpr promenljiva: ako bilo sta gore ne moze da se izracuna pri prevodjenju, prevodjenje ne uspeva
+constexpr KioskRouteData KIOSK_ROUTE = buildKioskRoute();
+
+const KioskRouteData& kioskRoute() {
+    return KIOSK_ROUTE;
+}
@@ -6,44 +6,69 @@
 #include <cstdlib>
 #include <ctime>
 #include <vector>
+#include <cstring>
 #include "../Header/Util.h"
+#include "../Header/ShaderProgram.h"
+#include "../Header/SpriteBatch.h"
+#include "../Header/TextureAtlas.h"
+#include "../Header/StationMarkers.h"
+#include "../Header/NetworkRenderer.h"
+#include "../Header/GLStateCache.h"
+#include "../Header/Simulation.h"
+#include "../Header/Route.h"
+#include "../Header/KioskRoute.h"
+#include "../Header/AdaptivePath.h"
+#include "../Header/Benchmark.h"
+#include "../Header/MonteCarlo.h"
+#include "../Header/PassengerPool.h"
+#include "../Header/Snapshot.h"
+#include "../Header/InputJournal.h"
+#include "../Header/InputQueue.h"
+#include "../Header/SimulationThread.h"
+#include "../Header/Timetable.h"
 
 // ========== KONSTANTE ==========
 const float TARGET_FPS = 75.0f;
 const float FRAME_TIME = 1.0f / TARGET_FPS;
-const int NUM_STATIONS = 10;
-const float BUS_SPEED = 0.15f;
-const float STATION_WAIT_TIME = 10.0f;
-
-// ========== STRUKTURE ==========
-struct Vec2 {
-    float x, y;
-    Vec2(float x = 0, float y = 0) : x(x), y(y) {}
-};
-
-struct Station {
-    Vec2 position;
-    int number;
-};
+const char* SNAPSHOT_PATH = "simulation.snap";
 
 // ========== GLOBALNE PROMENLJIVE ==========
 Station stations[NUM_STATIONS];
-int currentStation = 0;
-int nextStation = 1;
-float busProgress = 0.0f;
-bool busAtStation = true;
-float stationTimer = 0.0f;
-int passengers = 0;
-bool isInspectorInBus = false;
-int totalFines = 0;
-int inspectorExitStation = -1;
-
-bool leftMousePressed = false;
-bool rightMousePressed = false;
-bool keyKPressed = false;
-
-unsigned int pathVAO, pathVBO;
-unsigned int circleVAO, circleVBO;
+RouteGeometry routeGeometry;
+AdaptivePath adaptivePath;
+float pathPixelsPerUnit = 1.0f;   // piksela po jedinici NDC, za toleranciju teselacije
+// Koristi ga samo nit simulacije (logSimulationEvents)
+Timetable timetable;
+Simulation simulation;
+PassengerPool passengerPool;
+InputJournal journal;
+// Vlasnik simulacije, pool-a i dnevnika posle pokretanja; prikaz cita samo snimke
+SimulationThread simulationThread;
+const char* journalPath = NULL;
+
+// Callback-ovi upisuju ulaze u red, glavna petlja ih preuzima sve na pocetku frejma
+InputQueue inputQueue;
+
+// Cela mreza (za sada jedna zatvorena linija kroz sve stanice) u jednom baferu
+NetworkLine networkLines[] = { { 0, NUM_STATIONS, true } };
+NetworkPolyline networkPolyline;
+NetworkRenderer networkRenderer;
+const float NETWORK_PALETTE[NETWORK_PALETTE_SIZE * 3] = {
+    0.8f, 0.1f, 0.1f,
+    0.1f, 0.5f, 0.9f,
+    0.1f, 0.7f, 0.3f,
+    0.9f, 0.6f, 0.1f,
+    0.6f, 0.2f, 0.8f,
+    0.1f, 0.7f, 0.7f,
+    0.9f, 0.3f, 0.6f,
+    0.5f, 0.5f, 0.5f
+};
+
+UniformBuffer frameBuffer;
+// Svi teksturisani kvadrati (HUD, brojevi, autobus) idu kroz jedan paket po frejmu
+SpriteBatch spriteBatch;
+TextureAtlas atlas;
+StationMarkers stationMarkers;
 
 // ========== CALLBACK FUNKCIJE ==========
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
@@ -51,161 +76,144 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         glfwSetWindowShouldClose(window, true);
     }
     if (key == GLFW_KEY_K && action == GLFW_PRESS) {
-        keyKPressed = true;
+        inputQueue.push(glfwGetTime(), COMMAND_SEND_INSPECTOR);
+    }
+    if (key == GLFW_KEY_F5 && action == GLFW_PRESS) {
+        inputQueue.push(glfwGetTime(), COMMAND_SAVE_SNAPSHOT);
+    }
+    if (key == GLFW_KEY_F9 && action == GLFW_PRESS) {
+        inputQueue.push(glfwGetTime(), COMMAND_LOAD_SNAPSHOT);
+    }
+    if ((key == GLFW_KEY_KP_ADD || key == GLFW_KEY_EQUAL) && action == GLFW_PRESS) {
+        inputQueue.push(glfwGetTime(), COMMAND_WARP_FASTER);
+    }
+    if ((key == GLFW_KEY_KP_SUBTRACT || key == GLFW_KEY_MINUS) && action == GLFW_PRESS) {
+        inputQueue.push(glfwGetTime(), COMMAND_WARP_SLOWER);
     }
 }
 
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS) {
-        leftMousePressed = true;
+        inputQueue.push(glfwGetTime(), COMMAND_ADD_PASSENGER);
     }
     if (button == GLFW_MOUSE_BUTTON_RIGHT && action == GLFW_PRESS) {
-        rightMousePressed = true;
+        inputQueue.push(glfwGetTime(), COMMAND_REMOVE_PASSENGER);
     }
 }
 
 // ========== HELPER FUNKCIJE ==========
-Vec2 lerp(Vec2 a, Vec2 b, float t) {
-    return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
-}
-
-Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t) {
-    float u = 1.0f - t;
-    return Vec2(
-        u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
-        u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
-    );
-}
-
 void initStations() {
-
-    stations[0].position = Vec2(-0.65f, 0.55f);   // Top-left area
-    stations[1].position = Vec2(-0.25f, 0.65f);   // Top-center-left
-    stations[2].position = Vec2(0.35f, 0.60f);    // Top-right area
-    stations[3].position = Vec2(0.70f, 0.25f);    // Right side, upper
-    stations[4].position = Vec2(0.75f, -0.15f);   // Right side, lower
-    stations[5].position = Vec2(0.45f, -0.55f);   // Bottom-right
-    stations[6].position = Vec2(0.0f, -0.65f);    // Bottom-center
-    stations[7].position = Vec2(-0.50f, -0.50f);  // Bottom-left
-    stations[8].position = Vec2(-0.75f, -0.10f);  // Left side, lower
-    stations[9].position = Vec2(-0.70f, 0.20f);   // Left side, upper
-
+    // Stanice su deo rute izracunate pri prevodjenju (KioskRoute.cpp)
+    const KioskRouteData& route = kioskRoute();
     for (int i = 0; i < NUM_STATIONS; i++) {
-        stations[i].number = i;
+        stations[i] = route.stations[i];
     }
 }
 
-void setupPathVAO() {
-    std::vector<float> pathVertices;
-
-    for (int i = 0; i < NUM_STATIONS; i++) {
-        int nextIdx = (i + 1) % NUM_STATIONS;
-        Vec2 p0 = stations[i].position;
-        Vec2 p2 = stations[nextIdx].position;
-
-        Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
-        float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
-        Vec2 normal = Vec2(-dir.y, dir.x);
-
-        if (dist > 0.0001f) {
-            normal.x /= dist;
-            normal.y /= dist;
-        }
-
-
-        float curvature = 0.12f + 0.08f * sin(i * 0.7f);
-
-        float curveDir = (i % 3 == 0) ? -1.0f : 1.0f;
-
-        Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
-        Vec2 controlPoint = Vec2(
-            midPoint.x + normal.x * curvature * curveDir,
-            midPoint.y + normal.y * curvature * curveDir
-        );
-
-        int segments = 30;
-        for (int j = 0; j <= segments; j++) {
-            float t = (float)j / (float)segments;
-            Vec2 point = bezierQuadratic(p0, controlPoint, p2, t);
-            pathVertices.push_back(point.x);
-            pathVertices.push_back(point.y);
-        }
-    }
-
-    glGenVertexArrays(1, &pathVAO);
-    glGenBuffers(1, &pathVBO);
-
-    glBindVertexArray(pathVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, pathVBO);
-    glBufferData(GL_ARRAY_BUFFER, pathVertices.size() * sizeof(float), pathVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindVertexArray(0);
+void uploadNetwork() {
+    networkPolyline.build(adaptivePath, networkLines, sizeof(networkLines) / sizeof(networkLines[0]));
+    networkRenderer.upload(networkPolyline);
 }
 
-void setupCircleVAO() {
-    std::vector<float> circleVertices;
-    int segments = 50;
-
-    for (int i = 0; i <= segments; i++) {
-        float angle = (2.0f * 3.14159f * i) / segments;
-        circleVertices.push_back(cos(angle));
-        circleVertices.push_back(sin(angle));
-    }
-
-    glGenVertexArrays(1, &circleVAO);
-    glGenBuffers(1, &circleVBO);
-
-    glBindVertexArray(circleVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, circleVBO);
-    glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(float), circleVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindVertexArray(0);
+void setupNetwork() {
+    // Prilagodjena teselacija vec od prvog frejma, za razmeru ovog ekrana
+    adaptivePath.rebuild(routeGeometry, pathPixelsPerUnit);
+    uploadNetwork();
 }
 
-void setModelMatrix(unsigned int shaderProgram, float x, float y, float width, float height) {
-    float model[16] = {
-        width, 0.0f, 0.0f, 0.0f,
-        0.0f, height, 0.0f, 0.0f,
-        0.0f, 0.0f, 1.0f, 0.0f,
-        x, y, 0.0f, 1.0f
-    };
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "uModel"), 1, GL_FALSE, model);
+void drawAsset(int asset, float x, float y, float width, float height, float alpha = 1.0f, int layer = SPRITE_LAYER_MAP) {
+    const AtlasSprite& sprite = atlas[asset];
+    spriteBatch.draw(sprite.texture, x, y, width, height, alpha, sprite.uv, layer);
 }
 
-void renderTexture(unsigned int texture, float x, float y, float w, float h, float alpha, unsigned int shaderProgram, unsigned int VAO) {
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    glUniform1f(glGetUniformLocation(shaderProgram, "uAlpha"), alpha);
-    setModelMatrix(shaderProgram, x, y, w, h);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+SnapshotData snapshotData() {
+    SnapshotData data;
+    data.stations = stations;
+    data.stationCount = NUM_STATIONS;
+    data.route = &routeGeometry;
+    data.simulation = &simulation.state;
+    data.passengers = &passengerPool;
+    return data;
 }
 
-void renderCircle(float x, float y, float radius, float r, float g, float b, unsigned int shaderProgram) {
-    setModelMatrix(shaderProgram, x, y, radius, radius);
-    glUniform1f(glGetUniformLocation(shaderProgram, "uAlpha"), 1.0f);
-    glUniform3f(glGetUniformLocation(shaderProgram, "uColor"), r, g, b);
-    glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 1);
-
-    glBindVertexArray(circleVAO);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 52);
-
-    glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 0);
+// Poziva se na niti simulacije
+void logSimulationEvents(unsigned events, const SimulationState& s) {
+    if (events & EVENT_PASSENGER_ENTERED) {
+        std::cout << "Usao putnik. Ukupno: " << s.passengers << std::endl;
+    }
+    if (events & EVENT_PASSENGER_LEFT) {
+        std::cout << "Izasao putnik. Ukupno: " << s.passengers << std::endl;
+    }
+    if (events & EVENT_INSPECTOR_ENTERED) {
+        std::cout << ">>> KONTROLA USLA U AUTOBUS na stanici " << s.currentStation << " <<<" << std::endl;
+    }
+    if (events & EVENT_INSPECTOR_REJECTED) {
+        std::cout << ">>> KONTROLA NE MOZE DA UDJE - AUTOBUS JE PUN (" << MAX_PASSENGERS << " putnika) <<<" << std::endl;
+    }
+    if (events & EVENT_BUS_DEPARTED) {
+        // Red voznje se uskladjuje sa stvarnim stanjem na svakom polasku
+        timetable.syncBus(0, s);
+        uint64_t arrival = timetable.nextArrival(s.nextStation, s.tick);
+        std::cout << "Autobus krece ka stanici " << s.nextStation << " (dolazak za " << (arrival - s.tick) * SIMULATION_DT << " s)" << std::endl;
+        if (s.completedTrips > 0) {
+            std::cout << "Zavrsenih voznji: " << s.completedTrips << ", prosecno " << (float)s.tripStations / s.completedTrips << " stanica" << std::endl;
+        }
+    }
+    if (events & EVENT_BUS_ARRIVED) {
+        std::cout << "Autobus stigao na stanicu " << s.currentStation << std::endl;
+    }
+    if (events & EVENT_INSPECTOR_LEFT) {
+        std::cout << ">>> KONTROLA IZASLA na stanici " << s.currentStation << "! Naplaceno " << s.lastFines << " kazni. Ukupno kazni: " << s.totalFines << " <<<" << std::endl;
+    }
 }
 
 // ========== MAIN ==========
-int main()
+int main(int argc, char** argv)
 {
-    srand(time(NULL));
+    // Headless benchmark: Kostur.exe --bench [ime...]
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBenchmarks(argc - 2, argv + 2);
+    }
+    // Monte Karlo procena kazni: Kostur.exe --fines [voznji] [seed]
+    if (argc > 1 && strcmp(argv[1], "--fines") == 0) {
+        MonteCarloConfig config;
+        config.varianceReduction = VARIANCE_REDUCTION_ANTITHETIC;   // uz ogledalne parove najmanja greska (vidi --bench montecarlo)
+        if (argc > 2) {
+            char* end = NULL;
+            config.trips = strtoll(argv[2], &end, 10);
+            if (end == argv[2] || *end != '\0' || config.trips <= 0) {
+                std::cout << "Upotreba: Kostur.exe --fines [voznji] [seed], broj voznji mora biti pozitivan ceo broj" << std::endl;
+                return -1;
+            }
+        }
+        if (argc > 3) config.seed = strtoull(argv[3], NULL, 10);
+        printMonteCarloResult(config, estimateFines(config));
+        return 0;
+    }
+    // Headless ponavljanje snimljene sesije: Kostur.exe --replay dnevnik
+    if (argc > 2 && strcmp(argv[1], "--replay") == 0) {
+        InputJournal replay;
+        if (!replay.load(argv[2])) {
+            std::cout << "GRESKA: dnevnik nije ucitan: " << argv[2] << std::endl;
+            return -1;
+        }
+        ReplayResult result = replayJournal(replay);
+        double simulated = result.ticks * (double)SIMULATION_DT;
+        std::cout << "Ponovljeno " << result.events << " ulaza, " << result.ticks << " tikova (" << simulated << " s) za "
+            << result.seconds << " s, " << (simulated / result.seconds) << "x realno vreme" << std::endl;
+        std::cout << "Putnika: " << result.finalState.passengers << ", kazni: " << result.finalState.totalFines
+            << (result.matches ? " - poklapa se sa snimkom" : " - NE POKLAPA SE sa snimkom") << std::endl;
+        return result.matches ? 0 : -1;
+    }
+    // Snimanje sesije: Kostur.exe --record dnevnik
+    if (argc > 2 && strcmp(argv[1], "--record") == 0) {
+        journalPath = argv[2];
+    }
+
+    simulation.reset((uint64_t)time(NULL));
+    journal.begin(simulation.state.seed, simulation.state.bus);
+    passengerPool.reserve(MAX_PASSENGERS);
+    simulation.attachPassengerPool(&passengerPool);
 
     // ========== INICIJALIZACIJA GLFW ==========
     if (!glfwInit()) {
@@ -241,16 +249,24 @@ int main()
     std::cout << "GLSL verzija: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
 
     // ========== PODESAVANJA OPENGL ==========
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glState.setEnabled(GL_BLEND, true);
+    glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glViewport(0, 0, mode->width, mode->height);
+    // NDC [-1, 1] zauzima ceo ekran; za toleranciju se uzima duza osa
+    pathPixelsPerUnit = 0.5f * (float)(mode->width > mode->height ? mode->width : mode->height);
     glLineWidth(3.0f);
 
     // ========== UCITAVANJE SEJDERA ==========
     std::cout << "\n=== UCITAVANJE SEJDERA ===" << std::endl;
-    unsigned int shaderProgram = createShader("Resource Files/Shaders/basic.vert", "Resource Files/Shaders/basic.frag");
-    if (shaderProgram == 0) {
-        std::cout << "GRESKA: Sejderi nisu ucitani!" << std::endl;
+    frameBuffer.create(sizeof(FrameData), FRAME_DATA_BINDING);
+    // Sampler objekti imaju prednost nad parametrima teksture; glState.bindTexture vezuje sampler preseta teksture
+    createSamplers();
+    if (!networkRenderer.init("Resource Files/Shaders/network.vert", "Resource Files/Shaders/network.frag", NETWORK_PALETTE)) {
+        std::cout << "GRESKA: Sejderi za mrezu nisu ucitani!" << std::endl;
+        return -1;
+    }
+    if (!spriteBatch.init("Resource Files/Shaders/sprite.vert", "Resource Files/Shaders/sprite.frag")) {
+        std::cout << "GRESKA: Sejderi za sprajtove nisu ucitani!" << std::endl;
         return -1;
     }
     std::cout << "Sejderi uspesno ucitani!" << std::endl;
@@ -258,25 +274,13 @@ int main()
     // ========== UCITAVANJE TEKSTURA ==========
     std::cout << "\n=== UCITAVANJE TEKSTURA ===" << std::endl;
 
-    unsigned int busTexture = loadImageToTexture("Resource Files/Textures/2d_bus.png");
-    unsigned int stationTexture = loadImageToTexture("Resource Files/Textures/bus_station.png");
-    unsigned int controlTexture = loadImageToTexture("Resource Files/Textures/bus_control.png");
-    unsigned int doorClosedTexture = loadImageToTexture("Resource Files/Textures/closed_doors.png");
-    unsigned int doorOpenTexture = loadImageToTexture("Resource Files/Textures/opened_doors.png");
-    unsigned int authorTexture = loadImageToTexture("Resource Files/Textures/author_text.png");
-    unsigned int passengersLabelTexture = loadImageToTexture("Resource Files/Textures/passangers_label.png");
-    unsigned int finesLabelTexture = loadImageToTexture("Resource Files/Textures/fines.png");
-
-    unsigned int numberTextures[10];
-    for (int i = 0; i < 10; i++) {
-        std::string path = "Resource Files/Textures/number_" + std::to_string(i) + ".png";
-        numberTextures[i] = loadImageToTexture(path.c_str());
-    }
-
-    if (busTexture == 0 || stationTexture == 0 || doorClosedTexture == 0 || passengersLabelTexture == 0 || finesLabelTexture == 0) {
+    // Sve slike idu u atlas, pa ceo HUD deli jednu teksturu
+    if (!atlas.build()) {
         std::cout << "GRESKA: Neke teksture nisu ucitane!" << std::endl;
         return -1;
     }
+    std::cout << "Atlas: " << ASSET_COUNT << " slika u " << atlas.pages.size() << " stranica "
+        << ATLAS_PAGE_SIZE << "x" << ATLAS_PAGE_SIZE << std::endl;
 
     std::cout << "=== SVE TEKSTURE USPESNO UCITANE ===" << std::endl;
 
@@ -287,49 +291,40 @@ int main()
         std::cout << "Kursor uspesno ucitan!" << std::endl;
     }
 
-    // ========== VAO/VBO/EBO ZA TEKSTURE ==========
-    float vertices[] = {
-        -0.5f, -0.5f,   0.0f, 0.0f,
-         0.5f, -0.5f,   1.0f, 0.0f,
-         0.5f,  0.5f,   1.0f, 1.0f,
-        -0.5f,  0.5f,   0.0f, 1.0f
-    };
-
-    unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
-
-    unsigned int VAO, VBO, EBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    glBindVertexArray(0);
-
     // ========== INICIJALIZACIJA ==========
     initStations();
-    setupPathVAO();
-    setupCircleVAO();
+    routeGeometry.build(stations, kioskRoute().controlPoints, NUM_STATIONS);
+    timetable.build(routeGeometry);
+    timetable.addBus();
+    setupNetwork();
+    StationMarkerStyle markerStyle = { 0.06f, { 0.8f, 0.1f, 0.1f }, 0.05f, 0.06f };
+    if (!stationMarkers.init("Resource Files/Shaders/marker.vert", "Resource Files/Shaders/marker.frag", markerStyle)) {
+        std::cout << "GRESKA: Sejderi za stanice nisu ucitani!" << std::endl;
+        return -1;
+    }
     auto lastTime = std::chrono::high_resolution_clock::now();
+    float lastTimeScale = 1.0f;
+
+    simulationThread.start(&simulation, &inputQueue, journalPath != NULL ? &journal : NULL, logSimulationEvents);
+
+    // Ucitavanje tekstura i bafera je vezivalo objekte mimo kesa; brojanje pocinje od prvog frejma
+    glState.invalidate();
+    glState.resetStats();
+    unsigned long long renderedFrames = 0;
 
     std::cout << "\n========================================" << std::endl;
     std::cout << "=== PROGRAM POKRENUT ===" << std::endl;
+    float routeLength = 0.0f;
+    for (int i = 0; i < routeGeometry.segmentCount(); i++) {
+        routeLength += routeGeometry.segments[i].length;
+    }
+    std::cout << "Duzina rute: " << routeLength << std::endl;
     std::cout << "Kontrole:" << std::endl;
     std::cout << "  Levi klik - dodaj putnika" << std::endl;
     std::cout << "  Desni klik - ukloni putnika" << std::endl;
     std::cout << "  K - kontrola ulazi" << std::endl;
+    std::cout << "  F5 / F9 - sacuvaj / ucitaj stanje" << std::endl;
+    std::cout << "  + / - - ubrzaj / uspori simulaciju (1x - 1000x)" << std::endl;
     std::cout << "  ESC - izlaz" << std::endl;
     std::cout << "========================================\n" << std::endl;
 
@@ -344,195 +339,141 @@ int main()
         if (deltaTime.count() < FRAME_TIME) {
             continue;
         }
-        float dt = deltaTime.count();
         lastTime = currentTime;
 
         // ========== LOGIKA ==========
-        if (busAtStation) {
-            stationTimer += dt;
-
-            if (leftMousePressed) {
-                if (passengers < 50) {
-                    passengers++;
-                    std::cout << "Usao putnik. Ukupno: " << passengers << std::endl;
-                }
-            }
-            if (rightMousePressed) {
-                if (passengers > 0) {
-                    passengers--;
-                    std::cout << "Izasao putnik. Ukupno: " << passengers << std::endl;
-                }
-            }
-
-            if (keyKPressed && !isInspectorInBus) {
-                if (passengers < 50) {
-                    isInspectorInBus = true;
-                    passengers++;
-                    inspectorExitStation = (currentStation + 1) % NUM_STATIONS;
-                    std::cout << ">>> KONTROLA USLA U AUTOBUS na stanici " << currentStation << " <<<" << std::endl;
-                }
-                else {
-                    std::cout << ">>> KONTROLA NE MOZE DA UDJE - AUTOBUS JE PUN (50 putnika) <<<" << std::endl;
-                }
+        // Simulacija radi na svojoj niti; F5/F9 menjaju i stanice, pa ih radi prikaz dok je simulacija zaustavljena
+        unsigned requests = simulationThread.takeDisplayRequests();
+        if (requests & DISPLAY_REQUEST_SAVE) {
+            std::lock_guard<std::mutex> lock(simulationThread.stateMutex);
+            bool saved = saveSnapshot(SNAPSHOT_PATH, snapshotData());
+            std::cout << (saved ? "Stanje sacuvano u " : "GRESKA: stanje nije sacuvano u ") << SNAPSHOT_PATH << std::endl;
+        }
+        if ((requests & DISPLAY_REQUEST_LOAD) && journalPath != NULL) {
+            std::cout << "Ucitavanje stanja nije dozvoljeno dok se snima dnevnik" << std::endl;
+        }
+        else if (requests & DISPLAY_REQUEST_LOAD) {
+            std::lock_guard<std::mutex> lock(simulationThread.stateMutex);
+            SnapshotData data = snapshotData();
+            if (loadSnapshot(SNAPSHOT_PATH, data)) {
+                std::cout << "Stanje ucitano iz " << SNAPSHOT_PATH << std::endl;
             }
-
-            if (stationTimer >= STATION_WAIT_TIME) {
-                busAtStation = false;
-                stationTimer = 0.0f;
-                busProgress = 0.0f;
-                std::cout << "Autobus krece ka stanici " << nextStation << std::endl;
+            else {
+                std::cout << "GRESKA: stanje nije ucitano iz " << SNAPSHOT_PATH << std::endl;
             }
         }
-        else {
-            busProgress += BUS_SPEED * dt;
-            if (busProgress >= 1.0f) {
-                busProgress = 1.0f;
-                busAtStation = true;
-                stationTimer = 0.0f;
-                currentStation = nextStation;
-                nextStation = (currentStation + 1) % NUM_STATIONS;
-                std::cout << "Autobus stigao na stanicu " << currentStation << std::endl;
-
-                if (isInspectorInBus && currentStation == inspectorExitStation) {
-                    passengers--;
-                    int passengersWithoutInspector = passengers;
-                    int maxFines = passengersWithoutInspector > 0 ? passengersWithoutInspector : 0;
-                    int fines = (maxFines > 0) ? (rand() % (maxFines + 1)) : 0;
-                    totalFines += fines;
-                    std::cout << ">>> KONTROLA IZASLA na stanici " << currentStation << "! Naplaceno " << fines << " kazni. Ukupno kazni: " << totalFines << " <<<" << std::endl;
-                    isInspectorInBus = false;
-                    inspectorExitStation = -1;
-                }
-            }
+
+        // Prikaz vidi samo poslednji objavljen snimak; nit simulacije ga ne menja dok se crta
+        const RenderSnapshot& snapshot = simulationThread.latest();
+        if (snapshot.timeScale != lastTimeScale) {
+            lastTimeScale = snapshot.timeScale;
+            std::cout << "Ubrzanje simulacije: " << lastTimeScale << "x" << std::endl;
         }
 
-        leftMousePressed = false;
-        rightMousePressed = false;
-        keyKPressed = false;
+        // Geometrija se preracunava samo ako se neka stanica pomerila, a tacke putanje
+        // samo ako se promenila ruta (verzija) ili razmera prikaza
+        routeGeometry.update();
+        if (adaptivePath.update(routeGeometry, pathPixelsPerUnit)) {
+            uploadNetwork();
+        }
 
         // ========== RENDEROVANJE ==========
         glClearColor(0.15f, 0.2f, 0.25f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glUseProgram(shaderProgram);
-
-        // ========== PUTANJA (CRVENE KRIVE LINIJE) ==========
-        glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 1);
-        glUniform3f(glGetUniformLocation(shaderProgram, "uColor"), 0.8f, 0.1f, 0.1f);
-        glUniform1f(glGetUniformLocation(shaderProgram, "uAlpha"), 1.0f);
-
         float identityMatrix[16] = {
             1.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 1.0f, 0.0f, 0.0f,
             0.0f, 0.0f, 1.0f, 0.0f,
             0.0f, 0.0f, 0.0f, 1.0f
         };
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "uModel"), 1, GL_FALSE, identityMatrix);
 
-        glBindVertexArray(pathVAO);
-        for (int i = 0; i < NUM_STATIONS; i++) {
-            glDrawArrays(GL_LINE_STRIP, i * 31, 31);
-        }
+        // Jedan upis po frejmu za sve programe koji koriste FrameData
+        FrameData frame;
+        memcpy(frame.view, identityMatrix, sizeof(frame.view));
+        frame.time = (float)glfwGetTime();
+        frame.aspect = (float)mode->width / (float)mode->height;
+        frame.padding[0] = frame.padding[1] = 0.0f;
+        frameBuffer.update(&frame, sizeof(frame));
 
-        glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 0);
+        // ========== MREZA LINIJA ==========
+        // Sve linije jednim pozivom; boja dolazi iz palete po rednom broju linije
+        networkRenderer.draw();
 
-        // ========== STANICE (CRVENI KRUGOVI) ==========
-        for (int i = 0; i < NUM_STATIONS; i++) {
-            renderCircle(stations[i].position.x, stations[i].position.y, 0.06f, 0.8f, 0.1f, 0.1f, shaderProgram);
-        }
+        // ========== STANICE (CRVENI KRUGOVI I BELI BROJEVI) ==========
+        // Bafer instanci se puni samo kad se stanice promene; crtanje je uvek dva poziva
+        stationMarkers.update(stations, NUM_STATIONS, routeGeometry.version, atlas);
+        stationMarkers.draw();
 
-        // ========== BROJEVI NA STANICAMA (BELI) ==========
-        glBindVertexArray(VAO);
-        for (int i = 0; i < NUM_STATIONS; i++) {
-            renderTexture(numberTextures[i], stations[i].position.x, stations[i].position.y,
-                0.05f, 0.06f, 1.0f, shaderProgram, VAO);
-        }
+        // ========== SPRAJTOVI ==========
+        // Sve ispod se samo dodaje u paket; crta se u end(), grupisano po teksturi
+        spriteBatch.begin();
 
         // ========== AUTOBUS ==========
+        const SimulationState& sim = snapshot.state;
         Vec2 busPos;
-        if (busAtStation) {
-            busPos = stations[currentStation].position;
+        if (sim.busAtStation) {
+            busPos = stations[sim.currentStation].position;
         }
         else {
-            int prevIdx = currentStation;
-            int nextIdx = nextStation;
-            Vec2 p0 = stations[prevIdx].position;
-            Vec2 p2 = stations[nextIdx].position;
-
-            Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
-            float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
-            Vec2 normal = Vec2(-dir.y, dir.x);
-
-            if (dist > 0.0001f) {
-                normal.x /= dist;
-                normal.y /= dist;
-            }
-
-            float curvature = 0.12f + 0.08f * sin(prevIdx * 0.7f);
-            float curveDir = (prevIdx % 3 == 0) ? -1.0f : 1.0f;
-
-            Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
-            Vec2 controlPoint = Vec2(
-                midPoint.x + normal.x * curvature * curveDir,
-                midPoint.y + normal.y * curvature * curveDir
-            );
-
-            busPos = bezierQuadratic(p0, controlPoint, p2, busProgress);
+            // busProgress je udeo predjenog luka, pa se autobus krece konstantnom brzinom duz krive
+            busPos = routeGeometry.segments[sim.currentStation].table.positionAtFraction(sim.busProgress);
         }
-        renderTexture(busTexture, busPos.x, busPos.y, 0.15f, 0.08f, 1.0f, shaderProgram, VAO);
+        drawAsset(ASSET_BUS, busPos.x, busPos.y, 0.15f, 0.08f, 1.0f, SPRITE_LAYER_VEHICLES);
 
         // ========== VRATA ==========
-        unsigned int doorTexture = busAtStation ? doorOpenTexture : doorClosedTexture;
-        renderTexture(doorTexture, -0.85f, 0.75f, 0.12f, 0.18f, 1.0f, shaderProgram, VAO);
+        drawAsset(sim.busAtStation ? ASSET_DOOR_OPEN : ASSET_DOOR_CLOSED, -0.85f, 0.75f, 0.12f, 0.18f, 1.0f, SPRITE_LAYER_HUD);
 
         // ========== PUTNICI LABEL ==========
-        renderTexture(passengersLabelTexture, -0.90f, -0.65f, 0.20f, 0.08f, 1.0f, shaderProgram, VAO);
+        drawAsset(ASSET_PASSENGERS_LABEL, -0.90f, -0.65f, 0.20f, 0.08f, 1.0f, SPRITE_LAYER_HUD);
 
         // ========== BROJ PUTNIKA ==========
-        int tens = passengers / 10;
-        int ones = passengers % 10;
-        renderTexture(numberTextures[tens], -0.90f, -0.75f, 0.08f, 0.1f, 1.0f, shaderProgram, VAO);
-        renderTexture(numberTextures[ones], -0.80f, -0.75f, 0.08f, 0.1f, 1.0f, shaderProgram, VAO);
+        int tens = sim.passengers / 10;
+        int ones = sim.passengers % 10;
+        drawAsset(ASSET_NUMBER_0 + tens, -0.90f, -0.75f, 0.08f, 0.1f, 1.0f, SPRITE_LAYER_HUD);
+        drawAsset(ASSET_NUMBER_0 + ones, -0.80f, -0.75f, 0.08f, 0.1f, 1.0f, SPRITE_LAYER_HUD);
 
         // ========== FINES LABEL ==========
-        renderTexture(finesLabelTexture, -0.90f, -0.83f, 0.20f, 0.08f, 1.0f, shaderProgram, VAO);
+        drawAsset(ASSET_FINES_LABEL, -0.90f, -0.83f, 0.20f, 0.08f, 1.0f, SPRITE_LAYER_HUD);
 
         // ========== BROJ KAZNI ==========
-        int finesTens = (totalFines / 10) % 10;
-        int finesOnes = totalFines % 10;
-        renderTexture(numberTextures[finesTens], -0.90f, -0.93f, 0.08f, 0.1f, 1.0f, shaderProgram, VAO);
-        renderTexture(numberTextures[finesOnes], -0.80f, -0.93f, 0.08f, 0.1f, 1.0f, shaderProgram, VAO);
+        int finesTens = (sim.totalFines / 10) % 10;
+        int finesOnes = sim.totalFines % 10;
+        drawAsset(ASSET_NUMBER_0 + finesTens, -0.90f, -0.93f, 0.08f, 0.1f, 1.0f, SPRITE_LAYER_HUD);
+        drawAsset(ASSET_NUMBER_0 + finesOnes, -0.80f, -0.93f, 0.08f, 0.1f, 1.0f, SPRITE_LAYER_HUD);
 
         // ========== KONTROLA ==========
-        if (isInspectorInBus) {
-            renderTexture(controlTexture, 0.85f, 0.75f, 0.12f, 0.12f, 1.0f, shaderProgram, VAO);
+        if (sim.isInspectorInBus) {
+            drawAsset(ASSET_CONTROL, 0.85f, 0.75f, 0.12f, 0.12f, 1.0f, SPRITE_LAYER_HUD);
         }
 
         // ========== AUTHOR TEXT ==========
-        renderTexture(authorTexture, 0.65f, 0.88f, 0.3f, 0.1f, 0.7f, shaderProgram, VAO);
+        drawAsset(ASSET_AUTHOR, 0.65f, 0.88f, 0.3f, 0.1f, 0.7f, SPRITE_LAYER_HUD);
+
+        spriteBatch.end();
 
         glfwSwapBuffers(window);
+        renderedFrames++;
+    }
+
+    simulationThread.stop();
+    glState.printStats(renderedFrames);
+
+    if (journalPath != NULL) {
+        journal.finish(simulation.state);
+        bool saved = journal.save(journalPath);
+        std::cout << (saved ? "Dnevnik sacuvan: " : "GRESKA: dnevnik nije sacuvan: ") << journalPath
+            << " (" << journal.eventCount << " ulaza, " << journal.bytes.size() << " bajtova)" << std::endl;
     }
 
     // ========== CISCENJE ==========
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
-    glDeleteVertexArrays(1, &pathVAO);
-    glDeleteBuffers(1, &pathVBO);
-    glDeleteVertexArrays(1, &circleVAO);
-    glDeleteBuffers(1, &circleVBO);
-    glDeleteProgram(shaderProgram);
-
-    glDeleteTextures(1, &busTexture);
-    glDeleteTextures(1, &stationTexture);
-    glDeleteTextures(1, &controlTexture);
-    glDeleteTextures(1, &doorClosedTexture);
-    glDeleteTextures(1, &doorOpenTexture);
-    glDeleteTextures(1, &authorTexture);
-    glDeleteTextures(1, &passengersLabelTexture);
-    glDeleteTextures(1, &finesLabelTexture);
-    glDeleteTextures(10, numberTextures);
+    networkRenderer.destroy();
+    stationMarkers.destroy();
+    frameBuffer.destroy();
+    destroySamplers();
+    spriteBatch.destroy();
+
+    atlas.destroy();
 
     if (customCursor != NULL) {
         glfwDestroyCursor(customCursor);
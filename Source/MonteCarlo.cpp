@@ -0,0 +1,202 @@
+#include "../Header/MonteCarlo.h"
+#include "../Header/Simulation.h"
+#include "../Header/Random.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+const double MONTE_CARLO_QUANTILES[5] = { 0.05, 0.25, 0.50, 0.75, 0.95 };
+
+MonteCarloConfig::MonteCarloConfig() {
+    seed = 1;
+    trips = 100000000;
+    minLoad = 0;
+    maxLoad = MAX_PASSENGERS - 1;   // kontrola zauzima jedno mesto
+    threads = 0;
+    varianceReduction = VARIANCE_REDUCTION_NONE;
+    tripsPerDay = 1000;
+}
+
+// ========== RADNIK ==========
+// "Jedinica" je jedna voznja, ili par voznji kad je ukljucen antiteticki rezim.
+// Y je zbir kazni jedinice, K zbir opterecenja jedinice.
+struct MonteCarloSums {
+    long long trips;
+    long long sumF, sumF2;
+    long long units;
+    long long sumY, sumY2, sumK, sumK2, sumYK;
+    std::vector<long long> histogram;
+};
+
+static void runTrips(const MonteCarloConfig& config, long long firstUnit, long long lastUnit, MonteCarloSums& sums) {
+    const int BATCH = 1024;
+    uint32_t bits[BATCH * 4];
+    bool antithetic = (config.varianceReduction & VARIANCE_REDUCTION_ANTITHETIC) != 0;
+    uint32_t loadRange = (uint32_t)(config.maxLoad - config.minLoad + 1);
+
+    sums.trips = sums.sumF = sums.sumF2 = 0;
+    sums.units = sums.sumY = sums.sumY2 = sums.sumK = sums.sumK2 = sums.sumYK = 0;
+    sums.histogram.assign(config.maxLoad + 1, 0);
+    long long* histogram = sums.histogram.data();
+
+    long long unit = firstUnit;
+    while (unit < lastUnit) {
+        // Blok jedinice u je Philox blok broj u: tok je gornjih 32 bita, brojac donjih 32
+        long long streamEnd = (unit | 0xFFFFFFFFLL) + 1;
+        long long end = unit + BATCH;
+        if (end > lastUnit) end = lastUnit;
+        if (end > streamEnd) end = streamEnd;
+        int count = (int)(end - unit);
+        randomFillBits(config.seed, (uint32_t)(unit >> 32), (uint32_t)unit, bits, (size_t)count * 4);
+
+        for (int i = 0; i < count; i++) {
+            long long k = config.minLoad + (long long)(((uint64_t)bits[i * 4] * loadRange) >> 32);
+            long long f = (long long)(((uint64_t)bits[i * 4 + 1] * (uint32_t)(k + 1)) >> 32);
+            long long y = f;
+
+            histogram[f]++;
+            sums.sumF += f;
+            sums.sumF2 += f * f;
+            long long load = k;
+            if (antithetic) {
+                // Drugi clan para koristi ogledalne uniformne brojeve (1 - u) i za opterecenje i za kaznu.
+                // Samo ogledanje kazne uz isto K bi dalo g = K - f, pa bi zbir para bio bas K.
+                long long k2 = config.minLoad + (long long)(((uint64_t)~bits[i * 4] * loadRange) >> 32);
+                long long g = (long long)(((uint64_t)~bits[i * 4 + 1] * (uint32_t)(k2 + 1)) >> 32);
+                histogram[g]++;
+                sums.sumF += g;
+                sums.sumF2 += g * g;
+                y += g;
+                load += k2;
+            }
+
+            sums.sumY += y;
+            sums.sumY2 += y * y;
+            sums.sumK += load;
+            sums.sumK2 += load * load;
+            sums.sumYK += y * load;
+        }
+        sums.units += count;
+        unit = end;
+    }
+    sums.trips = antithetic ? sums.units * 2 : sums.units;
+}
+
+// ========== PROCENA ==========
+MonteCarloResult estimateFines(const MonteCarloConfig& config) {
+    auto start = std::chrono::high_resolution_clock::now();
+    bool antithetic = (config.varianceReduction & VARIANCE_REDUCTION_ANTITHETIC) != 0;
+    // Zbir opterecenja ogledalnog para je skoro konstantan, pa kontrolna promenljiva uz parove nema sta
+    // da objasni (a beta iz gotovo nulte varijanse je sum); uz antiteticki rezim se ne primenjuje
+    bool controlVariate = !antithetic && (config.varianceReduction & VARIANCE_REDUCTION_CONTROL_VARIATE) != 0;
+    long long units = antithetic ? (config.trips + 1) / 2 : config.trips;
+
+    int threads = config.threads;
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        if (threads <= 0) threads = 1;
+    }
+    if (units < threads) {
+        threads = units > 0 ? (int)units : 1;
+    }
+
+    std::vector<MonteCarloSums> partial(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        long long first = units * t / threads;
+        long long last = units * (t + 1) / threads;
+        workers.push_back(std::thread(runTrips, std::cref(config), first, last, std::ref(partial[t])));
+    }
+    for (int t = 0; t < threads; t++) {
+        workers[t].join();
+    }
+
+    MonteCarloSums total = partial[0];
+    for (int t = 1; t < threads; t++) {
+        const MonteCarloSums& p = partial[t];
+        total.trips += p.trips;
+        total.sumF += p.sumF;
+        total.sumF2 += p.sumF2;
+        total.units += p.units;
+        total.sumY += p.sumY;
+        total.sumY2 += p.sumY2;
+        total.sumK += p.sumK;
+        total.sumK2 += p.sumK2;
+        total.sumYK += p.sumYK;
+        for (size_t i = 0; i < total.histogram.size(); i++) {
+            total.histogram[i] += p.histogram[i];
+        }
+    }
+
+    MonteCarloResult result;
+    result.trips = total.trips;
+    result.threads = threads;
+    result.varianceReduction = (antithetic ? VARIANCE_REDUCTION_ANTITHETIC : 0) | (controlVariate ? VARIANCE_REDUCTION_CONTROL_VARIATE : 0);
+    result.histogram = total.histogram;
+
+    double n = (double)total.trips;
+    result.variance = n > 1 ? ((double)total.sumF2 - (double)total.sumF * total.sumF / n) / (n - 1) : 0.0;
+
+    // Procena srednje vrednosti po jedinicama (Y/scale je prosek kazni po voznji u jedinici)
+    double scale = antithetic ? 2.0 : 1.0;
+    // Bez ijedne voznje (trips <= 0) procena je 0, a ne deljenje nulom
+    double u = (double)total.units;
+    double meanY = u > 0 ? total.sumY / u : 0.0;
+    double meanK = u > 0 ? total.sumK / u : 0.0;
+    double varY = u > 1 ? ((double)total.sumY2 - total.sumY * meanY) / (u - 1) : 0.0;
+    double varK = u > 1 ? ((double)total.sumK2 - total.sumK * meanK) / (u - 1) : 0.0;
+    double covYK = u > 1 ? ((double)total.sumYK - total.sumY * meanK) / (u - 1) : 0.0;
+
+    double estimate = meanY;
+    double estimateVariance = varY;
+    if (controlVariate && varK > 0.0) {
+        double expectedK = (config.minLoad + config.maxLoad) / 2.0;
+        double beta = covYK / varK;
+        estimate = meanY - beta * (meanK - expectedK);
+        estimateVariance = varY - covYK * covYK / varK;
+        if (estimateVariance < 0.0) estimateVariance = 0.0;
+    }
+    result.mean = estimate / scale;
+    result.standardError = u > 0 ? sqrt(estimateVariance / u) / scale : 0.0;
+
+    // Kazne su celi brojevi 0..maxLoad, pa su kvantili tacni iz histograma
+    for (int q = 0; q < 5; q++) {
+        long long target = (long long)ceil(MONTE_CARLO_QUANTILES[q] * n);
+        long long cumulative = 0;
+        result.quantiles[q] = config.maxLoad;
+        for (int f = 0; f <= config.maxLoad; f++) {
+            cumulative += total.histogram[f];
+            if (cumulative >= target) {
+                result.quantiles[q] = f;
+                break;
+            }
+        }
+    }
+
+    // Ukupne kazni za dan: zbir tripsPerDay nezavisnih voznji
+    result.dayMean = result.mean * config.tripsPerDay;
+    result.dayStdDev = sqrt(result.variance * config.tripsPerDay);
+
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    return result;
+}
+
+void printMonteCarloResult(const MonteCarloConfig& config, const MonteCarloResult& result) {
+    std::cout << "Voznji: " << result.trips << ", niti: " << result.threads << ", vreme: " << result.seconds << " s ("
+        << (result.trips / result.seconds * 60.0) << " voznji/min)" << std::endl;
+    if (result.varianceReduction != config.varianceReduction) {
+        std::cout << "Upozorenje: kontrolna promenljiva se ne kombinuje sa antitetickim parovima, koriste se samo parovi" << std::endl;
+    }
+    std::cout << "Kazne po voznji: prosek " << result.mean << " +- " << result.standardError
+        << ", varijansa " << result.variance << std::endl;
+    std::cout << "Kvantili:";
+    for (int q = 0; q < 5; q++) {
+        std::cout << " " << (int)(MONTE_CARLO_QUANTILES[q] * 100) << "%=" << result.quantiles[q];
+    }
+    std::cout << std::endl;
+    std::cout << "Ukupno kazni za " << config.tripsPerDay << " voznji: prosek " << result.dayMean
+        << ", std. devijacija " << result.dayStdDev << std::endl;
+}
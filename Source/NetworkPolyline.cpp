@@ -0,0 +1,36 @@
+#include "../Header/NetworkPolyline.h"
+#include "../Header/AdaptivePath.h"
+
+void NetworkPolyline::build(const AdaptivePath& path, const NetworkLine* lines, int lineCount) {
+    vertices.clear();
+    indices.clear();
+    const float* points = path.vertices.data();
+
+    for (int l = 0; l < lineCount; l++) {
+        const NetworkLine& line = lines[l];
+        if (line.segmentCount <= 0) {
+            continue;
+        }
+        if (!indices.empty()) {
+            indices.push_back(NETWORK_RESTART_INDEX);
+        }
+
+        uint32_t lineStart = (uint32_t)vertices.size();
+        for (int s = 0; s < line.segmentCount; s++) {
+            const DrawRange& range = path.ranges[line.firstSegment + s];
+            // Prva tacka segmenta posle prvog je kraj prethodnog
+            int first = (s == 0) ? 0 : 1;
+            // Kod zatvorene linije kraj poslednjeg segmenta je pocetna tacka, pa se samo ponovi indeks
+            int last = (line.closed && s == line.segmentCount - 1) ? range.count - 1 : range.count;
+            for (int j = first; j < last; j++) {
+                const float* p = points + 2 * (range.first + j);
+                NetworkVertex vertex = { p[0], p[1], (uint32_t)l };
+                indices.push_back((uint32_t)vertices.size());
+                vertices.push_back(vertex);
+            }
+        }
+        if (line.closed) {
+            indices.push_back(lineStart);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#include "../Header/NetworkRenderer.h"
+#include "../Header/Util.h"
+#include "../Header/Samplers.h"
+#include "../Header/GLStateCache.h"
+
+#include <cstddef>
+
+NetworkRenderer::NetworkRenderer() {
+    vao = vbo = ebo = 0;
+    paletteTexture = 0;
+    indexCount = 0;
+}
+
+bool NetworkRenderer::init(const char* vertexPath, const char* fragmentPath, const float* palette) {
+    if (!shader.load(vertexPath, fragmentPath)) {
+        return false;
+    }
+    shader.bindBlock("FrameData", FRAME_DATA_BINDING);
+    shader.use();
+    ShaderProgram::set(shader.uniform("uPalette"), TEXTURE_UNIT_PALETTE);
+
+    unsigned char texels[NETWORK_PALETTE_SIZE * 4];
+    for (int i = 0; i < NETWORK_PALETTE_SIZE; i++) {
+        for (int c = 0; c < 3; c++) {
+            texels[i * 4 + c] = (unsigned char)(palette[i * 3 + c] * 255.0f + 0.5f);
+        }
+        texels[i * 4 + 3] = 255;
+    }
+    glGenTextures(1, &paletteTexture);
+    glBindTexture(GL_TEXTURE_2D, paletteTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, NETWORK_PALETTE_SIZE, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+    // Paleta se cita sa texelFetch, pa filtriranje ne utice na boju; bez mipmapa mora biti NEAREST/LINEAR
+    applySamplerToTexture(paletteTexture, SAMPLER_NEAREST_CLAMP);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glPrimitiveRestartIndex(NETWORK_RESTART_INDEX);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ebo);
+    glState.bindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(NetworkVertex), (void*)offsetof(NetworkVertex, x));
+    glEnableVertexAttribArray(0);
+    // Celobrojni atribut, da sejder dobije tacan indeks u paleti
+    glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(NetworkVertex), (void*)offsetof(NetworkVertex, line));
+    glEnableVertexAttribArray(1);
+    glState.bindVertexArray(0);
+    return true;
+}
+
+void NetworkRenderer::destroy() {
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteBuffers(1, &ebo);
+    forgetTextureSampler(paletteTexture);
+    glDeleteTextures(1, &paletteTexture);
+    shader.destroy();
+}
+
+void NetworkRenderer::upload(const NetworkPolyline& polyline) {
+    // GL_ARRAY_BUFFER nije deo stanja VAO-a, pa se bafer temena mora vezati posebno; EBO jeste
+    glState.bindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, polyline.vertices.size() * sizeof(NetworkVertex), polyline.vertices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, polyline.indices.size() * sizeof(uint32_t), polyline.indices.data(), GL_STATIC_DRAW);
+    glState.bindVertexArray(0);
+    indexCount = polyline.indexCount();
+}
+
+void NetworkRenderer::draw() const {
+    if (indexCount == 0) {
+        return;
+    }
+    shader.use();
+    glState.bindTexture(TEXTURE_UNIT_PALETTE, paletteTexture);
+
+    // Ostaje ukljuceno: ostali pozivi crtanja nemaju indeks NETWORK_RESTART_INDEX
+    glState.setEnabled(GL_PRIMITIVE_RESTART, true);
+    glState.bindVertexArray(vao);
+    glDrawElements(GL_LINE_STRIP, indexCount, GL_UNSIGNED_INT, 0);
+}
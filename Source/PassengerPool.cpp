@@ -0,0 +1,60 @@
+#include "../Header/PassengerPool.h"
+
+PassengerPool::PassengerPool() {
+    freeHead = PASSENGER_NONE;
+    completedHead = PASSENGER_NONE;
+    capacity = 0;
+    live = 0;
+    chunkAllocations = 0;
+}
+
+void PassengerPool::addChunk() {
+    Passenger* chunk = new Passenger[PASSENGER_CHUNK_SIZE];
+    chunkAllocations++;
+
+    // Nova mesta se ulancavaju u listu slobodnih, od prvog ka poslednjem
+    uint32_t first = capacity;
+    for (uint32_t i = 0; i < PASSENGER_CHUNK_SIZE; i++) {
+        chunk[i].next = (i + 1 < PASSENGER_CHUNK_SIZE) ? first + i + 1 : freeHead;
+    }
+    freeHead = first;
+    capacity += PASSENGER_CHUNK_SIZE;
+    chunks.push_back(std::unique_ptr<Passenger[]>(chunk));
+}
+
+void PassengerPool::reserve(uint32_t count) {
+    while (capacity < count) {
+        addChunk();
+    }
+}
+
+uint32_t PassengerPool::allocate(int boardingStation) {
+    if (freeHead == PASSENGER_NONE) {
+        addChunk();
+    }
+
+    uint32_t index = freeHead;
+    Passenger& p = (*this)[index];
+    freeHead = p.next;
+
+    p.boardingStation = (int16_t)boardingStation;
+    p.alightingStation = -1;
+    p.fareStatus = FARE_UNCHECKED;
+    p.next = PASSENGER_NONE;
+    live++;
+    return index;
+}
+
+void PassengerPool::complete(uint32_t index, int alightingStation) {
+    Passenger& p = (*this)[index];
+    p.alightingStation = (int16_t)alightingStation;
+    p.next = completedHead;
+    completedHead = index;
+}
+
+void PassengerPool::release(uint32_t index) {
+    Passenger& p = (*this)[index];
+    p.next = freeHead;
+    freeHead = index;
+    live--;
+}
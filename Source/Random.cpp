@@ -0,0 +1,112 @@
+#include "../Header/Random.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define RANDOM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Osam blokova (32 reci) po pozivu philoxBlocks
+const int RANDOM_BLOCKS = 8;
+const int RANDOM_CHUNK = RANDOM_BLOCKS * 4;
+
+#ifdef RANDOM_SSE2
+// Proizvod 4 x (32 x 32 -> 64 bita): _mm_mul_epu32 radi parne trake, pa se neparne pomeraju
+static inline void mulHiLo(__m128i a, __m128i m, __m128i& hi, __m128i& lo) {
+    __m128i even = _mm_mul_epu32(a, m);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+// Jedna grupa od 4 bloka: svaki SSE2 registar drzi istu rec stanja za 4 brojaca
+struct PhiloxLanes {
+    __m128i c0, c1, c2, c3;
+};
+
+static inline void philoxRound(PhiloxLanes& s, __m128i m0, __m128i m1, __m128i key0, __m128i key1) {
+    __m128i hi0, lo0, hi1, lo1;
+    mulHiLo(s.c0, m0, hi0, lo0);
+    mulHiLo(s.c2, m1, hi1, lo1);
+    s.c0 = _mm_xor_si128(_mm_xor_si128(hi1, s.c1), key0);
+    s.c1 = lo1;
+    s.c2 = _mm_xor_si128(_mm_xor_si128(hi0, s.c3), key1);
+    s.c3 = lo0;
+}
+
+// Transponovanje 4x4, da reci svakog bloka budu zajedno (isti redosled kao randomBits)
+static inline void storeBlocks(const PhiloxLanes& s, uint32_t* out) {
+    __m128i t0 = _mm_unpacklo_epi32(s.c0, s.c1);
+    __m128i t1 = _mm_unpacklo_epi32(s.c2, s.c3);
+    __m128i t2 = _mm_unpackhi_epi32(s.c0, s.c1);
+    __m128i t3 = _mm_unpackhi_epi32(s.c2, s.c3);
+    _mm_storeu_si128((__m128i*)(out + 0), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i*)(out + 8), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i*)(out + 12), _mm_unpackhi_epi64(t2, t3));
+}
+
+static void philoxBlocks(uint64_t seed, uint32_t stream, uint32_t firstBlock, uint32_t out[RANDOM_CHUNK]) {
+    // Dve nezavisne grupe se racunaju naizmenicno, da se sakrije kasnjenje mnozenja
+    PhiloxLanes a, b;
+    a.c0 = _mm_add_epi32(_mm_set1_epi32((int)firstBlock), _mm_setr_epi32(0, 1, 2, 3));
+    b.c0 = _mm_add_epi32(a.c0, _mm_set1_epi32(4));
+    a.c1 = b.c1 = _mm_set1_epi32((int)stream);
+    a.c2 = b.c2 = _mm_setzero_si128();
+    a.c3 = b.c3 = _mm_setzero_si128();
+    __m128i m0 = _mm_set1_epi32((int)PHILOX_M0);
+    __m128i m1 = _mm_set1_epi32((int)PHILOX_M1);
+
+    uint32_t key0 = (uint32_t)seed;
+    uint32_t key1 = (uint32_t)(seed >> 32);
+    for (int round = 0; round < 10; round++) {
+        __m128i k0 = _mm_set1_epi32((int)key0);
+        __m128i k1 = _mm_set1_epi32((int)key1);
+        philoxRound(a, m0, m1, k0, k1);
+        philoxRound(b, m0, m1, k0, k1);
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+    }
+
+    storeBlocks(a, out);
+    storeBlocks(b, out + 16);
+}
+#else
+static void philoxBlocks(uint64_t seed, uint32_t stream, uint32_t firstBlock, uint32_t out[RANDOM_CHUNK]) {
+    for (int j = 0; j < RANDOM_BLOCKS; j++) {
+        uint32_t counter[4] = { firstBlock + j, stream, 0, 0 };
+        philox4x32(counter, (uint32_t)seed, (uint32_t)(seed >> 32), out + j * 4);
+    }
+}
+#endif
+
+void randomFillBits(uint64_t seed, uint32_t stream, uint32_t firstBlock, uint32_t* out, size_t count) {
+    uint32_t block[RANDOM_CHUNK];
+    size_t done = 0;
+
+    for (; done + RANDOM_CHUNK <= count; done += RANDOM_CHUNK) {
+        philoxBlocks(seed, stream, firstBlock, out + done);
+        firstBlock += RANDOM_BLOCKS;
+    }
+    if (done < count) {
+        philoxBlocks(seed, stream, firstBlock, block);
+        for (size_t i = 0; done + i < count; i++) {
+            out[done + i] = block[i];
+        }
+    }
+}
+
+void randomFillUniform(uint64_t seed, uint32_t stream, uint32_t firstBlock, float* out, size_t count) {
+    uint32_t block[RANDOM_CHUNK];
+    size_t done = 0;
+
+    while (done < count) {
+        philoxBlocks(seed, stream, firstBlock, block);
+        firstBlock += RANDOM_BLOCKS;
+
+        size_t take = count - done < RANDOM_CHUNK ? count - done : RANDOM_CHUNK;
+        for (size_t i = 0; i < take; i++) {
+            out[done + i] = (block[i] >> 8) * (1.0f / 16777216.0f);
+        }
+        done += take;
+    }
+}
@@ -0,0 +1,198 @@
+#include "../Header/Route.h"
+
+#include <cmath>
+
+// ========== KRIVE ==========
+Vec2 lerp(Vec2 a, Vec2 b, float t) {
+    return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+}
+
+Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t) {
+    float u = 1.0f - t;
+    return Vec2(
+        u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
+        u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
+    );
+}
+
+Vec2 segmentControlPoint(Vec2 p0, Vec2 p2, int segment) {
+    Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
+    float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
+    Vec2 normal = Vec2(-dir.y, dir.x);
+
+    if (dist > 0.0001f) {
+        normal.x /= dist;
+        normal.y /= dist;
+    }
+
+    float curvature = 0.12f + 0.08f * sin(segment * 0.7f);
+    float curveDir = (segment % 3 == 0) ? -1.0f : 1.0f;
+
+    Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
+    return Vec2(
+        midPoint.x + normal.x * curvature * curveDir,
+        midPoint.y + normal.y * curvature * curveDir
+    );
+}
+
+// ========== TABELA DUZINE LUKA ==========
+void ArcLengthTable::build(Vec2 p0, Vec2 p1, Vec2 p2) {
+    // Gusto uzorkovanje po t, pa kumulativna duzina
+    const int DENSE = ARC_TABLE_SAMPLES * 8;
+    float cumulative[DENSE + 1];
+    cumulative[0] = 0.0f;
+    Vec2 prev = p0;
+    for (int i = 1; i <= DENSE; i++) {
+        Vec2 point = bezierQuadratic(p0, p1, p2, (float)i / DENSE);
+        float dx = point.x - prev.x;
+        float dy = point.y - prev.y;
+        cumulative[i] = cumulative[i - 1] + sqrt(dx * dx + dy * dy);
+        prev = point;
+    }
+    length = cumulative[DENSE];
+
+    // Za svaku ciljnu duzinu trazimo t (kumulativni niz je rastuci, pa ide jedan prolaz)
+    int j = 0;
+    for (int k = 0; k <= ARC_TABLE_SAMPLES; k++) {
+        float target = length * k / ARC_TABLE_SAMPLES;
+        while (j < DENSE - 1 && cumulative[j + 1] < target) {
+            j++;
+        }
+        float span = cumulative[j + 1] - cumulative[j];
+        float local = span > 0.0f ? (target - cumulative[j]) / span : 0.0f;
+        float t = (j + local) / DENSE;
+        if (t > 1.0f) t = 1.0f;
+
+        params[k] = t;
+        positions[k] = bezierQuadratic(p0, p1, p2, t);
+    }
+    params[0] = 0.0f;
+    params[ARC_TABLE_SAMPLES] = 1.0f;
+    positions[0] = p0;
+    positions[ARC_TABLE_SAMPLES] = p2;
+}
+
+Vec2 ArcLengthTable::positionAtFraction(float fraction) const {
+    float f = fraction * ARC_TABLE_SAMPLES;
+    if (f <= 0.0f) return positions[0];
+    if (f >= ARC_TABLE_SAMPLES) return positions[ARC_TABLE_SAMPLES];
+    int i = (int)f;
+    return lerp(positions[i], positions[i + 1], f - i);
+}
+
+float ArcLengthTable::parameterAtFraction(float fraction) const {
+    float f = fraction * ARC_TABLE_SAMPLES;
+    if (f <= 0.0f) return 0.0f;
+    if (f >= ARC_TABLE_SAMPLES) return 1.0f;
+    int i = (int)f;
+    return params[i] + (params[i + 1] - params[i]) * (f - i);
+}
+
+void BezierCurves::clear() {
+    p0x.clear(); p0y.clear();
+    p1x.clear(); p1y.clear();
+    p2x.clear(); p2y.clear();
+}
+
+void BezierCurves::add(Vec2 p0, Vec2 p1, Vec2 p2) {
+    p0x.push_back(p0.x); p0y.push_back(p0.y);
+    p1x.push_back(p1.x); p1y.push_back(p1.y);
+    p2x.push_back(p2.x); p2y.push_back(p2.y);
+}
+
+// ========== GEOMETRIJA RUTE ==========
+static void quadraticBounds(Vec2 p0, Vec2 p1, Vec2 p2, Vec2& outMin, Vec2& outMax) {
+    outMin = Vec2(fmin(p0.x, p2.x), fmin(p0.y, p2.y));
+    outMax = Vec2(fmax(p0.x, p2.x), fmax(p0.y, p2.y));
+
+    // Ekstrem po svakoj osi je tamo gde je izvod nula: t = (p0 - p1) / (p0 - 2p1 + p2)
+    float denomX = p0.x - 2.0f * p1.x + p2.x;
+    float denomY = p0.y - 2.0f * p1.y + p2.y;
+    if (fabs(denomX) > 1e-6f) {
+        float t = (p0.x - p1.x) / denomX;
+        if (t > 0.0f && t < 1.0f) {
+            Vec2 e = bezierQuadratic(p0, p1, p2, t);
+            outMin.x = fmin(outMin.x, e.x);
+            outMax.x = fmax(outMax.x, e.x);
+        }
+    }
+    if (fabs(denomY) > 1e-6f) {
+        float t = (p0.y - p1.y) / denomY;
+        if (t > 0.0f && t < 1.0f) {
+            Vec2 e = bezierQuadratic(p0, p1, p2, t);
+            outMin.y = fmin(outMin.y, e.y);
+            outMax.y = fmax(outMax.y, e.y);
+        }
+    }
+}
+
+// Izvedeni podaci segmenta kad su kontrolne tacke poznate
+static void buildSegment(RouteSegment& seg) {
+    seg.table.build(seg.p0, seg.p1, seg.p2);
+    seg.length = seg.table.length;
+    quadraticBounds(seg.p0, seg.p1, seg.p2, seg.boundsMin, seg.boundsMax);
+}
+
+void RouteGeometry::build(const Station* stations, int count) {
+    stationPositions.resize(count);
+    for (int i = 0; i < count; i++) {
+        stationPositions[i] = stations[i].position;
+    }
+    segments.resize(count);
+    dirty.assign(count, true);
+    update();
+}
+
+void RouteGeometry::build(const Station* stations, const Vec2* controlPoints, int count) {
+    stationPositions.resize(count);
+    for (int i = 0; i < count; i++) {
+        stationPositions[i] = stations[i].position;
+    }
+    segments.resize(count);
+    dirty.assign(count, false);
+    curves.clear();
+    for (int i = 0; i < count; i++) {
+        RouteSegment& seg = segments[i];
+        seg.p0 = stationPositions[i];
+        seg.p1 = controlPoints[i];
+        seg.p2 = stationPositions[(i + 1) % count];
+        buildSegment(seg);
+        curves.add(seg.p0, seg.p1, seg.p2);
+    }
+    version++;
+}
+
+void RouteGeometry::moveStation(int index, Vec2 position) {
+    int count = (int)stationPositions.size();
+    stationPositions[index] = position;
+    // Stanica je kraj prethodnog i pocetak svog segmenta
+    dirty[(index + count - 1) % count] = true;
+    dirty[index] = true;
+}
+
+bool RouteGeometry::update() {
+    int count = (int)segments.size();
+    bool changed = false;
+
+    for (int i = 0; i < count; i++) {
+        if (!dirty[i]) {
+            continue;
+        }
+        RouteSegment& seg = segments[i];
+        seg.p0 = stationPositions[i];
+        seg.p2 = stationPositions[(i + 1) % count];
+        seg.p1 = segmentControlPoint(seg.p0, seg.p2, i);
+        buildSegment(seg);
+        dirty[i] = false;
+        changed = true;
+    }
+
+    if (changed) {
+        curves.clear();
+        for (int i = 0; i < count; i++) {
+            curves.add(segments[i].p0, segments[i].p1, segments[i].p2);
+        }
+        version++;
+    }
+    return changed;
+}
@@ -0,0 +1,73 @@
+#include "../Header/Samplers.h"
+#include "../Header/Util.h"
+
+#include <vector>
+
+struct SamplerParameters {
+    GLint minFilter;
+    GLint magFilter;
+    GLint wrap;
+};
+
+static const SamplerParameters SAMPLER_PARAMETERS[SAMPLER_PRESET_COUNT] = {
+    { GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE },
+    { GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE },
+    { GL_LINEAR, GL_LINEAR, GL_REPEAT },
+    { GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE }
+};
+
+static unsigned int samplers[SAMPLER_PRESET_COUNT];
+// Preset po imenu teksture; GL imena su mali uzastopni brojevi, pa je niz dovoljan
+static std::vector<unsigned char> texturePresets;
+
+bool samplerUsesMipmaps(SamplerPreset preset) {
+    GLint filter = SAMPLER_PARAMETERS[preset].minFilter;
+    return filter != GL_LINEAR && filter != GL_NEAREST;
+}
+
+void applySamplerToTexture(unsigned int texture, SamplerPreset preset) {
+    const SamplerParameters& p = SAMPLER_PARAMETERS[preset];
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, p.minFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, p.magFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, p.wrap);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, p.wrap);
+    if (samplerUsesMipmaps(preset)) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    if (texture >= texturePresets.size()) {
+        texturePresets.resize(texture + 1, SAMPLER_LINEAR_CLAMP);
+    }
+    texturePresets[texture] = (unsigned char)preset;
+}
+
+SamplerPreset textureSampler(unsigned int texture) {
+    return texture < texturePresets.size() ? (SamplerPreset)texturePresets[texture] : SAMPLER_LINEAR_CLAMP;
+}
+
+void forgetTextureSampler(unsigned int texture) {
+    if (texture < texturePresets.size()) {
+        texturePresets[texture] = SAMPLER_LINEAR_CLAMP;
+    }
+}
+
+void createSamplers() {
+    glGenSamplers(SAMPLER_PRESET_COUNT, samplers);
+    for (int i = 0; i < SAMPLER_PRESET_COUNT; i++) {
+        const SamplerParameters& p = SAMPLER_PARAMETERS[i];
+        glSamplerParameteri(samplers[i], GL_TEXTURE_MIN_FILTER, p.minFilter);
+        glSamplerParameteri(samplers[i], GL_TEXTURE_MAG_FILTER, p.magFilter);
+        glSamplerParameteri(samplers[i], GL_TEXTURE_WRAP_S, p.wrap);
+        glSamplerParameteri(samplers[i], GL_TEXTURE_WRAP_T, p.wrap);
+    }
+}
+
+void destroySamplers() {
+    glDeleteSamplers(SAMPLER_PRESET_COUNT, samplers);
+    for (int i = 0; i < SAMPLER_PRESET_COUNT; i++) {
+        samplers[i] = 0;
+    }
+}
+
+unsigned int samplerObject(SamplerPreset preset) {
+    return samplers[preset];
+}
@@ -0,0 +1,123 @@
+#include "../Header/ShaderProgram.h"
+#include "../Header/Util.h"
+#include "../Header/GLStateCache.h"
+
+#include <cstring>
+
+ShaderProgram::ShaderProgram() {
+    id = 0;
+}
+
+bool ShaderProgram::load(const char* vertexPath, const char* fragmentPath) {
+    id = createShader(vertexPath, fragmentPath);
+    if (id == 0) {
+        return false;
+    }
+    int linked = GL_FALSE;
+    glGetProgramiv(id, GL_LINK_STATUS, &linked);
+    if (linked == GL_FALSE) {
+        glDeleteProgram(id);   // neuspesno linkovan program se ne zadrzava
+        id = 0;
+        return false;
+    }
+
+    // Jedini prolaz kroz imena uniformi; niz se vodi pod imenom bez "[0]"
+    int count = 0;
+    int maxLength = 0;
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::vector<char> name(maxLength + 1);
+    uniformNames.clear();
+    uniformLocations.clear();
+    for (int i = 0; i < count; i++) {
+        int length = 0, size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(id, (GLuint)i, maxLength + 1, &length, &size, &type, name.data());
+        int location = glGetUniformLocation(id, name.data());
+        if (location < 0) {
+            continue;   // uniforma iz bloka, ne postavlja se pojedinacno
+        }
+        std::string uniformName(name.data(), length);
+        if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0) {
+            uniformName.resize(uniformName.size() - 3);
+        }
+        uniformNames.push_back(uniformName);
+        uniformLocations.push_back(location);
+    }
+    return true;
+}
+
+void ShaderProgram::destroy() {
+    if (id != 0) {
+        glState.forgetProgram(id);
+        glDeleteProgram(id);
+        id = 0;
+    }
+}
+
+int ShaderProgram::uniform(const char* name) const {
+    for (size_t i = 0; i < uniformNames.size(); i++) {
+        if (uniformNames[i] == name) {
+            return uniformLocations[i];
+        }
+    }
+    return -1;
+}
+
+bool ShaderProgram::bindBlock(const char* blockName, unsigned int binding) const {
+    unsigned int index = glGetUniformBlockIndex(id, blockName);
+    if (index == GL_INVALID_INDEX) {
+        return false;
+    }
+    glUniformBlockBinding(id, index, binding);
+    return true;
+}
+
+// Program i uniforme idu kroz GLStateCache, pa se ista vrednost ne salje drajveru dva puta
+void ShaderProgram::use() const {
+    glState.useProgram(id);
+}
+
+void ShaderProgram::set(int location, int value) {
+    glState.uniform(location, value);
+}
+
+void ShaderProgram::set(int location, float value) {
+    glState.uniform(location, value);
+}
+
+void ShaderProgram::set(int location, float x, float y, float z) {
+    glState.uniform(location, x, y, z);
+}
+
+void ShaderProgram::setMatrix(int location, const float* matrix4) {
+    glState.uniformMatrix(location, matrix4);
+}
+
+// ========== UNIFORM BUFFER ==========
+UniformBuffer::UniformBuffer() {
+    id = 0;
+    size = 0;
+}
+
+void UniformBuffer::create(unsigned int bufferSize, unsigned int binding) {
+    size = bufferSize;
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferData(GL_UNIFORM_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, binding, id);
+}
+
+void UniformBuffer::update(const void* data, unsigned int dataSize) {
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, dataSize < size ? dataSize : size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void UniformBuffer::destroy() {
+    if (id != 0) {
+        glDeleteBuffers(1, &id);
+        id = 0;
+    }
+}
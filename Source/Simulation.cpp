@@ -0,0 +1,164 @@
+#include "../Header/Simulation.h"
+#include "../Header/Random.h"
+#include "../Header/PassengerPool.h"
+
+Simulation::Simulation(uint64_t seed, uint32_t bus) {
+    passengerPool = 0;
+    state.onboardHead = PASSENGER_NONE;
+    reset(seed, bus);
+}
+
+static void releaseOnboard(PassengerPool* pool, uint32_t head) {
+    if (pool == 0) {
+        return;
+    }
+    while (head != PASSENGER_NONE) {
+        uint32_t next = (*pool)[head].next;
+        pool->release(head);
+        head = next;
+    }
+    // Neobradjene zavrsene voznje pripadaju stanju koje se odbacuje
+    pool->drainCompleted([](const Passenger&) {});
+}
+
+void Simulation::attachPassengerPool(PassengerPool* pool) {
+    releaseOnboard(passengerPool, state.onboardHead);
+    passengerPool = pool;
+    state.onboardHead = PASSENGER_NONE;
+
+    // Putnici koji su vec u autobusu dobijaju agente sa nepoznatom stanicom ukrcavanja
+    for (int i = 0; pool != 0 && i < state.passengers - (state.isInspectorInBus ? 1 : 0); i++) {
+        uint32_t index = pool->allocate(-1);
+        (*pool)[index].next = state.onboardHead;
+        state.onboardHead = index;
+    }
+}
+
+void Simulation::reset(uint64_t seed, uint32_t bus) {
+    releaseOnboard(passengerPool, state.onboardHead);
+    state.onboardHead = PASSENGER_NONE;
+    state.currentStation = 0;
+    state.nextStation = 1;
+    state.busProgress = 0.0f;
+    state.busAtStation = true;
+    state.stationTimer = 0.0f;
+    state.passengers = 0;
+    state.isInspectorInBus = false;
+    state.totalFines = 0;
+    state.inspectorExitStation = -1;
+    state.lastFines = 0;
+    state.seed = seed;
+    state.bus = bus;
+    state.rngEvent = 0;
+    state.tick = 0;
+    state.completedTrips = 0;
+    state.tripStations = 0;
+}
+
+unsigned Simulation::handleInput(SimulationInput input) {
+    // Putnici i kontrola mogu da udju/izadju samo dok su vrata otvorena
+    if (!state.busAtStation) {
+        return EVENT_NONE;
+    }
+
+    switch (input) {
+    case INPUT_ADD_PASSENGER:
+        if (state.passengers < MAX_PASSENGERS) {
+            state.passengers++;
+            if (passengerPool != 0) {
+                uint32_t index = passengerPool->allocate(state.currentStation);
+                (*passengerPool)[index].next = state.onboardHead;
+                state.onboardHead = index;
+            }
+            return EVENT_PASSENGER_ENTERED;
+        }
+        break;
+    case INPUT_REMOVE_PASSENGER:
+        if (state.passengers > 0) {
+            // Kontrola ne izlazi na desni klik; ako su u autobusu samo kontrola, nema ko da izadje
+            if (state.isInspectorInBus && state.passengers == 1) {
+                break;
+            }
+            state.passengers--;
+            if (passengerPool != 0 && state.onboardHead != PASSENGER_NONE) {
+                // Izlazi poslednji koji je usao; zapis ostaje do polaska, kad se voznja obracuna
+                uint32_t index = state.onboardHead;
+                state.onboardHead = (*passengerPool)[index].next;
+                passengerPool->complete(index, state.currentStation);
+            }
+            return EVENT_PASSENGER_LEFT;
+        }
+        break;
+    case INPUT_SEND_INSPECTOR:
+        if (state.isInspectorInBus) {
+            break;
+        }
+        if (state.passengers < MAX_PASSENGERS) {
+            state.isInspectorInBus = true;
+            state.passengers++;
+            state.inspectorExitStation = (state.currentStation + 1) % NUM_STATIONS;
+            return EVENT_INSPECTOR_ENTERED;
+        }
+        return EVENT_INSPECTOR_REJECTED;
+    }
+    return EVENT_NONE;
+}
+
+unsigned Simulation::step(float dt) {
+    unsigned events = EVENT_NONE;
+    state.tick++;
+
+    if (state.busAtStation) {
+        state.stationTimer += dt;
+
+        if (state.stationTimer >= STATION_WAIT_TIME) {
+            state.busAtStation = false;
+            state.stationTimer = 0.0f;
+            state.busProgress = 0.0f;
+            events |= EVENT_BUS_DEPARTED;
+            if (passengerPool != 0) {
+                SimulationState& s = state;
+                passengerPool->drainCompleted([&s](const Passenger& p) {
+                    if (p.boardingStation >= 0) {
+                        s.completedTrips++;
+                        s.tripStations += (uint32_t)((p.alightingStation - p.boardingStation + NUM_STATIONS) % NUM_STATIONS);
+                    }
+                });
+            }
+        }
+    }
+    else {
+        state.busProgress += BUS_SPEED * dt;
+        if (state.busProgress >= 1.0f) {
+            state.busProgress = 1.0f;
+            state.busAtStation = true;
+            state.stationTimer = 0.0f;
+            state.currentStation = state.nextStation;
+            state.nextStation = (state.currentStation + 1) % NUM_STATIONS;
+            events |= EVENT_BUS_ARRIVED;
+
+            if (state.isInspectorInBus && state.currentStation == state.inspectorExitStation) {
+                state.passengers--;
+                int passengersWithoutInspector = state.passengers;
+                int maxFines = passengersWithoutInspector > 0 ? passengersWithoutInspector : 0;
+                int fines = (maxFines > 0) ? randomInt(state.seed, state.bus, state.rngEvent, maxFines + 1) : 0;
+                state.rngEvent++;
+                if (passengerPool != 0) {
+                    // Prvih "fines" putnika u listi je kaznjeno, ostali su imali kartu
+                    int checked = 0;
+                    for (uint32_t i = state.onboardHead; i != PASSENGER_NONE; i = (*passengerPool)[i].next) {
+                        (*passengerPool)[i].fareStatus = (uint8_t)(checked < fines ? FARE_FINED : FARE_PAID);
+                        checked++;
+                    }
+                }
+                state.totalFines += fines;
+                state.lastFines = fines;
+                state.isInspectorInBus = false;
+                state.inspectorExitStation = -1;
+                events |= EVENT_INSPECTOR_LEFT;
+            }
+        }
+    }
+
+    return events;
+}
@@ -0,0 +1,109 @@
+#include "../Header/SimulationThread.h"
+
+#include <chrono>
+
+typedef std::chrono::steady_clock ThreadClock;
+
+SimulationThread::SimulationThread() : displayRequests(0), running(false) {
+    simulation = 0;
+    input = 0;
+    journal = 0;
+    onEvents = 0;
+    rate = SIMULATION_THREAD_RATE;
+    sequence = 0;
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start(Simulation* sim, InputQueue* queue, InputJournal* recordJournal, SimulationEventCallback callback) {
+    simulation = sim;
+    input = queue;
+    journal = recordJournal;
+    onEvents = callback;
+    publish();
+    snapshots.update();
+
+    running.store(true, std::memory_order_release);
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() {
+    running.store(false, std::memory_order_release);
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+const RenderSnapshot& SimulationThread::latest() {
+    snapshots.update();
+    return snapshots.readBuffer();
+}
+
+unsigned SimulationThread::takeDisplayRequests() {
+    return displayRequests.exchange(0, std::memory_order_acquire);
+}
+
+// ========== NIT SIMULACIJE ==========
+void SimulationThread::run() {
+    const ThreadClock::duration period = std::chrono::duration_cast<ThreadClock::duration>(std::chrono::duration<double>(1.0 / rate));
+    ThreadClock::time_point last = ThreadClock::now();
+    ThreadClock::time_point next = last + period;
+
+    while (running.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_until(next);
+        ThreadClock::time_point now = ThreadClock::now();
+        std::chrono::duration<float> dt = now - last;
+        last = now;
+        // Ako je nit kasnila (npr. racunar je bio uspavan), ne pokusava da stigne propustena budjenja
+        next += period;
+        if (next < now) {
+            next = now + period;
+        }
+        tick(dt.count());
+    }
+}
+
+void SimulationThread::tick(float dt) {
+    uint32_t count = input != 0 ? input->drain(inputBatch, INPUT_QUEUE_CAPACITY) : 0;
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    for (uint32_t i = 0; i < count; i++) {
+        applyCommand(inputBatch[i].command);
+    }
+    warp.advance(*simulation, dt, 0, onEvents);
+    publish();
+}
+
+void SimulationThread::applyCommand(uint32_t command) {
+    if (isSimulationCommand(command)) {
+        if (journal != 0) {
+            journal->record(simulation->state.tick, (SimulationInput)command);
+        }
+        unsigned events = simulation->handleInput((SimulationInput)command);
+        if (events != EVENT_NONE && onEvents != 0) {
+            onEvents(events, simulation->state);
+        }
+    }
+    else if (command == COMMAND_WARP_FASTER) {
+        warp.faster();
+    }
+    else if (command == COMMAND_WARP_SLOWER) {
+        warp.slower();
+    }
+    else if (command == COMMAND_SAVE_SNAPSHOT) {
+        displayRequests.fetch_or(DISPLAY_REQUEST_SAVE, std::memory_order_release);
+    }
+    else if (command == COMMAND_LOAD_SNAPSHOT) {
+        displayRequests.fetch_or(DISPLAY_REQUEST_LOAD, std::memory_order_release);
+    }
+}
+
+void SimulationThread::publish() {
+    RenderSnapshot& snapshot = snapshots.writeBuffer();
+    snapshot.state = simulation->state;
+    snapshot.timeScale = warp.scale();
+    snapshot.sequence = ++sequence;
+    snapshots.publish();
+}
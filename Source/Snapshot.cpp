@@ -0,0 +1,417 @@
+#include "../Header/Snapshot.h"
+#include "../Header/Simulation.h"
+#include "../Header/Route.h"
+#include "../Header/Fleet.h"
+#include "../Header/PassengerPool.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const uint64_t SNAPSHOT_ALIGNMENT = 64;
+
+struct SnapshotPoolState {
+    uint32_t freeHead;
+    uint32_t capacity;
+    uint32_t live;
+    uint32_t completedHead;
+};
+
+SnapshotData::SnapshotData() {
+    stations = 0;
+    stationCount = 0;
+    route = 0;
+    simulation = 0;
+    fleet = 0;
+    passengers = 0;
+}
+
+// ========== SNIMANJE ==========
+struct PendingSection {
+    SnapshotSection info;
+    const void* data;   // null za putnike, oni se pisu po komadima arene
+};
+
+static void addSection(std::vector<PendingSection>& list, uint32_t id, uint32_t elementSize, uint64_t count, const void* data) {
+    PendingSection pending;
+    pending.info.id = id;
+    pending.info.elementSize = elementSize;
+    pending.info.offset = 0;
+    pending.info.count = count;
+    pending.data = data;
+    list.push_back(pending);
+}
+
+bool saveSnapshot(const char* path, const SnapshotData& data) {
+    std::vector<PendingSection> sections;
+    SnapshotPoolState poolState;
+
+    if (data.stations != 0) {
+        addSection(sections, SNAPSHOT_STATIONS, sizeof(Station), data.stationCount, data.stations);
+    }
+    if (data.route != 0) {
+        addSection(sections, SNAPSHOT_ROUTE_SEGMENTS, sizeof(RouteSegment), data.route->segments.size(), data.route->segments.data());
+    }
+    if (data.simulation != 0) {
+        addSection(sections, SNAPSHOT_SIMULATION, sizeof(SimulationState), 1, data.simulation);
+    }
+    if (data.fleet != 0) {
+        const Fleet& f = *data.fleet;
+        addSection(sections, SNAPSHOT_FLEET_PROGRESS, sizeof(float), f.progress.size(), f.progress.data());
+        addSection(sections, SNAPSHOT_FLEET_TIMER, sizeof(float), f.stationTimer.size(), f.stationTimer.data());
+        addSection(sections, SNAPSHOT_FLEET_SEGMENT, sizeof(int), f.segment.size(), f.segment.data());
+        addSection(sections, SNAPSHOT_FLEET_FLAGS, sizeof(unsigned int), f.flags.size(), f.flags.data());
+    }
+    if (data.passengers != 0) {
+        poolState.freeHead = data.passengers->freeHead;
+        poolState.capacity = data.passengers->capacity;
+        poolState.live = data.passengers->live;
+        poolState.completedHead = data.passengers->completedHead;
+        addSection(sections, SNAPSHOT_PASSENGER_POOL, sizeof(SnapshotPoolState), 1, &poolState);
+        addSection(sections, SNAPSHOT_PASSENGERS, sizeof(Passenger), data.passengers->capacity, 0);
+    }
+
+    // Raspored: zaglavlje, pa sekcije redom, svaka poravnata
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.sectionCount = (uint32_t)sections.size();
+
+    uint64_t offset = sizeof(SnapshotHeader);
+    for (size_t i = 0; i < sections.size(); i++) {
+        offset = (offset + SNAPSHOT_ALIGNMENT - 1) & ~(SNAPSHOT_ALIGNMENT - 1);
+        sections[i].info.offset = offset;
+        header.sections[i] = sections[i].info;
+        offset += sections[i].info.count * sections[i].info.elementSize;
+    }
+    header.fileSize = offset;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write((const char*)&header, sizeof(header));
+
+    static const char padding[SNAPSHOT_ALIGNMENT] = { 0 };
+    uint64_t written = sizeof(header);
+    for (size_t i = 0; i < sections.size(); i++) {
+        const SnapshotSection& info = sections[i].info;
+        file.write(padding, (std::streamsize)(info.offset - written));
+
+        if (info.id == SNAPSHOT_PASSENGERS) {
+            const PassengerPool& pool = *data.passengers;
+            for (size_t c = 0; c < pool.chunks.size(); c++) {
+                file.write((const char*)pool.chunks[c].get(), PASSENGER_CHUNK_SIZE * sizeof(Passenger));
+            }
+        }
+        else {
+            file.write((const char*)sections[i].data, (std::streamsize)(info.count * info.elementSize));
+        }
+        written = info.offset + info.count * info.elementSize;
+    }
+
+    return file.good();
+}
+
+// ========== MAPIRANJE ==========
+MappedSnapshot::MappedSnapshot() {
+    base = 0;
+    size = 0;
+    fileHandle = 0;
+    mappingHandle = 0;
+}
+
+MappedSnapshot::~MappedSnapshot() {
+    close();
+}
+
+bool MappedSnapshot::open(const char* path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+    base = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    fileHandle = file;
+    mappingHandle = mapping;
+    size = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    fstat(fd, &info);
+    size = (size_t)info.st_size;
+    void* mapped = size > 0 ? mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    base = mapped != MAP_FAILED ? (const unsigned char*)mapped : 0;
+#endif
+
+    if (base == 0) {
+        close();
+        return false;
+    }
+
+    // Jedina provera pre koriscenja: zaglavlje i granice sekcija.
+    // Broj elemenata se poredi deljenjem, jer bi count * elementSize iz ostecenog fajla mogao da se prelije.
+    // Sekcije su uvek poravnate na SNAPSHOT_ALIGNMENT (a mapa na stranicu), pa je pokazivac ispravno poravnat za svaki tip.
+    const SnapshotHeader* h = header();
+    bool valid = size >= sizeof(SnapshotHeader) && h->magic == SNAPSHOT_MAGIC && h->version == SNAPSHOT_VERSION
+        && h->fileSize == size && h->sectionCount <= (uint32_t)SNAPSHOT_MAX_SECTIONS;
+    for (uint32_t i = 0; valid && i < h->sectionCount; i++) {
+        const SnapshotSection& s = h->sections[i];
+        valid = s.elementSize > 0 && s.offset % SNAPSHOT_ALIGNMENT == 0 && s.offset <= size
+            && s.count <= (size - s.offset) / s.elementSize;
+    }
+    if (!valid) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedSnapshot::close() {
+#ifdef _WIN32
+    if (base != 0) UnmapViewOfFile(base);
+    if (mappingHandle != 0) CloseHandle((HANDLE)mappingHandle);
+    if (fileHandle != 0) CloseHandle((HANDLE)fileHandle);
+#else
+    if (base != 0) munmap((void*)base, size);
+#endif
+    base = 0;
+    size = 0;
+    fileHandle = 0;
+    mappingHandle = 0;
+}
+
+const void* MappedSnapshot::section(uint32_t id, uint32_t elementSize, uint64_t* count) const {
+    if (base == 0) {
+        return 0;
+    }
+    const SnapshotHeader* h = header();
+    for (uint32_t i = 0; i < h->sectionCount; i++) {
+        if (h->sections[i].id == id) {
+            // Drugacija velicina elementa znaci da se raspored strukture promenio
+            if (h->sections[i].elementSize != elementSize) {
+                return 0;
+            }
+            if (count != 0) {
+                *count = h->sections[i].count;
+            }
+            return base + h->sections[i].offset;
+        }
+    }
+    return 0;
+}
+
+// ========== VRACANJE ==========
+template <typename T>
+static bool copyArray(const MappedSnapshot& snapshot, uint32_t id, std::vector<T>& out) {
+    uint64_t count = 0;
+    const T* data = (const T*)snapshot.section(id, sizeof(T), &count);
+    if (data == 0) {
+        return false;
+    }
+    out.assign(data, data + count);
+    return true;
+}
+
+// Vrednosti koje prikaz i Simulation::step koriste kao indekse ili granice petlji
+static bool validSimulationState(const SimulationState& s) {
+    return s.currentStation >= 0 && s.currentStation < NUM_STATIONS
+        && s.nextStation == (s.currentStation + 1) % NUM_STATIONS
+        && (!s.isInspectorInBus || (s.inspectorExitStation >= 0 && s.inspectorExitStation < NUM_STATIONS))
+        && s.passengers >= (s.isInspectorInBus ? 1 : 0) && s.passengers <= MAX_PASSENGERS
+        && s.busProgress >= 0.0f && s.busProgress <= 1.0f
+        && std::isfinite(s.stationTimer) && s.stationTimer >= 0.0f
+        && s.totalFines >= 0 && s.lastFines >= 0;
+}
+
+// Prolazi listu kroz arenu i oznacava putnike; false ako lista prodje kroz vec oznacenog putnika
+// (petlja ili dve liste koje dele putnika). Veze su vec proverene da su unutar arene.
+static bool markPassengerList(const Passenger* passengers, uint32_t head, std::vector<char>& visited, uint32_t* length) {
+    uint32_t count = 0;
+    for (uint32_t i = head; i != PASSENGER_NONE; i = passengers[i].next) {
+        if (visited[i]) {
+            return false;
+        }
+        visited[i] = 1;
+        count++;
+    }
+    if (length != 0) {
+        *length = count;
+    }
+    return true;
+}
+
+bool restoreSnapshot(const MappedSnapshot& snapshot, SnapshotData& data) {
+    // Prvo se proveravaju sve trazene sekcije, a stanje se menja tek kad su sve ispravne,
+    // pa neuspelo ucitavanje ne ostavlja delimicno vraceno stanje
+    const Station* stations = 0;
+    const RouteSegment* segments = 0;
+    const SimulationState* state = 0;
+    const SnapshotPoolState* poolState = 0;
+    const Passenger* passengers = 0;
+    uint64_t segmentCount = 0;
+    uint64_t count = 0;
+
+    if (data.stations != 0) {
+        stations = (const Station*)snapshot.section(SNAPSHOT_STATIONS, sizeof(Station), &count);
+        if (stations == 0 || count != (uint64_t)data.stationCount) {
+            return false;
+        }
+    }
+
+    if (data.route != 0) {
+        segments = (const RouteSegment*)snapshot.section(SNAPSHOT_ROUTE_SEGMENTS, sizeof(RouteSegment), &segmentCount);
+        // Prikaz indeksira segmente rednim brojem stanice, pa ih mora biti tacno toliko
+        if (segments == 0 || segmentCount != (uint64_t)data.stationCount) {
+            return false;
+        }
+    }
+
+    if (data.simulation != 0) {
+        state = (const SimulationState*)snapshot.section(SNAPSHOT_SIMULATION, sizeof(SimulationState), &count);
+        if (state == 0 || count != 1 || !validSimulationState(*state)) {
+            return false;
+        }
+    }
+
+    if (data.fleet != 0) {
+        // Svi nizovi flote moraju postojati i imati isti broj autobusa
+        const uint32_t FLEET_SECTIONS[] = { SNAPSHOT_FLEET_PROGRESS, SNAPSHOT_FLEET_TIMER, SNAPSHOT_FLEET_SEGMENT, SNAPSHOT_FLEET_FLAGS };
+        const uint32_t FLEET_SIZES[] = { sizeof(float), sizeof(float), sizeof(int), sizeof(unsigned int) };
+        uint64_t buses = 0;
+        for (int i = 0; i < 4; i++) {
+            if (snapshot.section(FLEET_SECTIONS[i], FLEET_SIZES[i], &count) == 0 || (i > 0 && count != buses)) {
+                return false;
+            }
+            buses = count;
+        }
+        const float* progress = (const float*)snapshot.section(SNAPSHOT_FLEET_PROGRESS, sizeof(float), &count);
+        const float* timers = (const float*)snapshot.section(SNAPSHOT_FLEET_TIMER, sizeof(float), &count);
+        const int* busSegments = (const int*)snapshot.section(SNAPSHOT_FLEET_SEGMENT, sizeof(int), &count);
+        for (uint64_t i = 0; i < buses; i++) {
+            if (busSegments[i] < 0 || busSegments[i] >= NUM_STATIONS || !(progress[i] >= 0.0f && progress[i] <= 1.0f)
+                || !std::isfinite(timers[i]) || timers[i] < 0.0f) {
+                return false;
+            }
+        }
+    }
+
+    if (data.passengers != 0) {
+        poolState = (const SnapshotPoolState*)snapshot.section(SNAPSHOT_PASSENGER_POOL, sizeof(SnapshotPoolState), &count);
+        if (poolState == 0 || count != 1) {
+            return false;
+        }
+        passengers = (const Passenger*)snapshot.section(SNAPSHOT_PASSENGERS, sizeof(Passenger), &count);
+        uint32_t capacity = poolState->capacity;
+        // Arena se vraca po celim komadima, a svi komadi moraju biti u fajlu
+        if (passengers == 0 || capacity % PASSENGER_CHUNK_SIZE != 0 || count != capacity || poolState->live > capacity
+            || (poolState->freeHead != PASSENGER_NONE && poolState->freeHead >= capacity)
+            || (poolState->completedHead != PASSENGER_NONE && poolState->completedHead >= capacity)) {
+            return false;
+        }
+        // Veze izmedju putnika se posle koriste kao indeksi, pa moraju biti unutar snimljene arene
+        for (uint32_t i = 0; i < capacity; i++) {
+            if (passengers[i].next != PASSENGER_NONE && passengers[i].next >= capacity) {
+                return false;
+            }
+        }
+        if (state != 0 && state->onboardHead != PASSENGER_NONE && state->onboardHead >= capacity) {
+            return false;
+        }
+        // Slobodni, zavrseni i putnici u autobusu su disjunktne liste bez petlji
+        std::vector<char> visited(capacity, 0);
+        uint32_t onboard = 0;
+        if (!markPassengerList(passengers, poolState->freeHead, visited, 0)
+            || !markPassengerList(passengers, poolState->completedHead, visited, 0)
+            || (state != 0 && !markPassengerList(passengers, state->onboardHead, visited, &onboard))) {
+            return false;
+        }
+        if (state != 0 && (int)onboard > state->passengers - (state->isInspectorInBus ? 1 : 0)) {
+            return false;
+        }
+    }
+
+    // ========== PRIMENA ==========
+    if (stations != 0) {
+        memcpy(data.stations, stations, sizeof(Station) * data.stationCount);
+    }
+
+    if (segments != 0) {
+        RouteGeometry& route = *data.route;
+        route.segments.assign(segments, segments + segmentCount);
+        // Izvedeni podaci se samo prepisuju iz segmenata, bez ponovnog racunanja geometrije
+        int segmentTotal = route.segmentCount();
+        route.stationPositions.resize(segmentTotal);
+        route.dirty.assign(segmentTotal, false);
+        route.curves.clear();
+        for (int i = 0; i < segmentTotal; i++) {
+            route.stationPositions[i] = route.segments[i].p0;
+            route.curves.add(route.segments[i].p0, route.segments[i].p1, route.segments[i].p2);
+        }
+        route.version++;
+    }
+
+    if (state != 0) {
+        *data.simulation = *state;
+    }
+
+    if (data.fleet != 0) {
+        Fleet& f = *data.fleet;
+        copyArray(snapshot, SNAPSHOT_FLEET_PROGRESS, f.progress);
+        copyArray(snapshot, SNAPSHOT_FLEET_TIMER, f.stationTimer);
+        copyArray(snapshot, SNAPSHOT_FLEET_SEGMENT, f.segment);
+        copyArray(snapshot, SNAPSHOT_FLEET_FLAGS, f.flags);
+    }
+
+    if (poolState != 0) {
+        PassengerPool& pool = *data.passengers;
+        pool.reserve(poolState->capacity);
+        for (uint32_t c = 0; c < poolState->capacity / PASSENGER_CHUNK_SIZE; c++) {
+            memcpy(pool.chunks[c].get(), passengers + (size_t)c * PASSENGER_CHUNK_SIZE, PASSENGER_CHUNK_SIZE * sizeof(Passenger));
+        }
+        // Ako arena vec ima vise mesta nego snimak, visak se vraca u listu slobodnih
+        pool.freeHead = poolState->freeHead;
+        for (uint32_t i = pool.capacity; i > poolState->capacity; i--) {
+            pool[i - 1].next = pool.freeHead;
+            pool.freeHead = i - 1;
+        }
+        pool.completedHead = poolState->completedHead;
+        pool.live = poolState->live;
+    }
+
+    return true;
+}
+
+bool loadSnapshot(const char* path, SnapshotData& data) {
+    MappedSnapshot snapshot;
+    if (!snapshot.open(path)) {
+        return false;
+    }
+    return restoreSnapshot(snapshot, data);
+}
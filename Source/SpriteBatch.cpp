@@ -0,0 +1,98 @@
+#include "../Header/SpriteBatch.h"
+#include "../Header/Util.h"
+#include "../Header/Samplers.h"
+#include "../Header/GLStateCache.h"
+
+#include <cstddef>
+#include <vector>
+
+SpriteBatch::SpriteBatch() {
+    textureUniform = -1;
+    vao = vbo = ebo = 0;
+    capacity = 0;
+    stats.sprites = 0;
+    stats.drawCalls = 0;
+}
+
+bool SpriteBatch::init(const char* vertexPath, const char* fragmentPath) {
+    if (!shader.load(vertexPath, fragmentPath)) {
+        return false;
+    }
+    textureUniform = shader.uniform("uTex");
+    shader.bindBlock("FrameData", FRAME_DATA_BINDING);
+    shader.use();
+    ShaderProgram::set(textureUniform, TEXTURE_UNIT_SPRITES);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ebo);
+
+    glState.bindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, x));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, u));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, alpha));
+    glEnableVertexAttribArray(2);
+    reserveQuads(256);
+    glState.bindVertexArray(0);
+    return true;
+}
+
+void SpriteBatch::reserveQuads(int quads) {
+    // Indeksi su isti svaki frejm (0 1 2 2 3 0 po kvadratu), pa se pune samo kad kapacitet poraste
+    std::vector<unsigned int> indices((size_t)quads * 6);
+    for (int q = 0; q < quads; q++) {
+        unsigned int base = (unsigned int)q * 4;
+        unsigned int* i = &indices[(size_t)q * 6];
+        i[0] = base; i[1] = base + 1; i[2] = base + 2;
+        i[3] = base + 2; i[4] = base + 3; i[5] = base;
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    capacity = quads;
+}
+
+void SpriteBatch::destroy() {
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteBuffers(1, &ebo);
+    shader.destroy();
+}
+
+void SpriteBatch::begin() {
+    list.clear();
+}
+
+void SpriteBatch::end() {
+    list.build();
+    stats.sprites = list.size();
+    stats.drawCalls = 0;
+    if (list.size() == 0) {
+        return;
+    }
+
+    shader.use();
+    glState.bindVertexArray(vao);
+    if (list.size() > capacity) {
+        int quads = capacity;
+        while (quads < list.size()) quads *= 2;
+        reserveQuads(quads);
+    }
+
+    // Stari sadrzaj se odbacuje (orphaning), da drajver ne ceka GPU koji mozda jos crta prosli frejm
+    size_t bytes = list.vertices.size() * sizeof(SpriteVertex);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, bytes, NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, list.vertices.data());
+
+    glState.setEnabled(GL_BLEND, true);
+    glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    for (size_t r = 0; r < list.runs.size(); r++) {
+        const SpriteRun& run = list.runs[r];
+        glState.bindTexture(TEXTURE_UNIT_SPRITES, run.texture);
+        glDrawElements(GL_TRIANGLES, run.quadCount * 6, GL_UNSIGNED_INT, (void*)((size_t)run.firstQuad * 6 * sizeof(unsigned int)));
+        stats.drawCalls++;
+    }
+}
@@ -0,0 +1,63 @@
+#include "../Header/SpriteList.h"
+
+#include <algorithm>
+
+void SpriteList::clear() {
+    sprites.clear();
+    sorted.clear();
+    vertices.clear();
+    runs.clear();
+}
+
+void SpriteList::add(unsigned int texture, float x, float y, float width, float height, float alpha, UvRect uv, int layer) {
+    Sprite sprite;
+    sprite.texture = texture;
+    sprite.layer = layer;
+    sprite.order = (uint32_t)sprites.size();
+    sprite.x = x;
+    sprite.y = y;
+    sprite.width = width;
+    sprite.height = height;
+    sprite.uv = uv;
+    sprite.alpha = alpha;
+    sprites.push_back(sprite);
+}
+
+void SpriteList::build() {
+    int count = size();
+    sorted.resize(count);
+    for (int i = 0; i < count; i++) {
+        sorted[i] = (uint32_t)i;
+    }
+    // Kljuc (sloj, tekstura, redosled) je jedinstven, pa je obican sort i stabilan
+    const Sprite* s = sprites.data();
+    std::sort(sorted.begin(), sorted.end(), [s](uint32_t a, uint32_t b) {
+        if (s[a].layer != s[b].layer) return s[a].layer < s[b].layer;
+        if (s[a].texture != s[b].texture) return s[a].texture < s[b].texture;
+        return s[a].order < s[b].order;
+    });
+
+    vertices.resize((size_t)count * 4);
+    runs.clear();
+    SpriteVertex* v = vertices.data();
+    for (int q = 0; q < count; q++) {
+        const Sprite& sprite = s[sorted[q]];
+        float x0 = sprite.x - sprite.width * 0.5f, x1 = sprite.x + sprite.width * 0.5f;
+        float y0 = sprite.y - sprite.height * 0.5f, y1 = sprite.y + sprite.height * 0.5f;
+        // Isti redosled temena kao kvadrat u main: dole levo, dole desno, gore desno, gore levo
+        v[0] = { x0, y0, sprite.uv.u0, sprite.uv.v0, sprite.alpha };
+        v[1] = { x1, y0, sprite.uv.u1, sprite.uv.v0, sprite.alpha };
+        v[2] = { x1, y1, sprite.uv.u1, sprite.uv.v1, sprite.alpha };
+        v[3] = { x0, y1, sprite.uv.u0, sprite.uv.v1, sprite.alpha };
+        v += 4;
+
+        // Susedni kvadrati sa istom teksturom se spajaju i preko granice sloja
+        if (!runs.empty() && runs.back().texture == sprite.texture) {
+            runs.back().quadCount++;
+        }
+        else {
+            SpriteRun run = { sprite.texture, q, 1 };
+            runs.push_back(run);
+        }
+    }
+}
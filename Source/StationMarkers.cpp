@@ -0,0 +1,164 @@
+#include "../Header/StationMarkers.h"
+#include "../Header/TextureAtlas.h"
+#include "../Header/Util.h"
+#include "../Header/Samplers.h"
+#include "../Header/GLStateCache.h"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+StationMarkers::StationMarkers() {
+    useTextureUniform = -1;
+    circleVAO = circleVBO = 0;
+    labelVAO = labelVBO = 0;
+    instanceVBO = 0;
+    labelTexture = 0;
+    count = 0;
+    builtVersion = 0;
+    built = false;
+}
+
+void StationMarkers::setupInstanceAttributes(size_t firstInstance) const {
+    // Atributi 2-5 se pomeraju jednom po instanci; krugovi i brojevi dele isti bafer, razlikuje se samo pocetak
+    size_t base = firstInstance * sizeof(MarkerInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MarkerInstance), (void*)(base + offsetof(MarkerInstance, x)));
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(MarkerInstance), (void*)(base + offsetof(MarkerInstance, width)));
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(MarkerInstance), (void*)(base + offsetof(MarkerInstance, r)));
+    glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(MarkerInstance), (void*)(base + offsetof(MarkerInstance, uv)));
+    for (int attribute = 2; attribute <= 5; attribute++) {
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribDivisor(attribute, 1);
+    }
+}
+
+bool StationMarkers::init(const char* vertexPath, const char* fragmentPath, const StationMarkerStyle& markerStyle) {
+    if (!shader.load(vertexPath, fragmentPath)) {
+        return false;
+    }
+    style = markerStyle;
+    useTextureUniform = shader.uniform("uUseTexture");
+    shader.bindBlock("FrameData", FRAME_DATA_BINDING);
+    shader.use();
+    ShaderProgram::set(shader.uniform("uTex"), TEXTURE_UNIT_SPRITES);
+
+    // Jedinicni krug (lepeza) i jedinicni kvadrat: polozaj i UV unutar oznake
+    std::vector<float> circle;
+    circle.push_back(0.0f); circle.push_back(0.0f);
+    circle.push_back(0.5f); circle.push_back(0.5f);
+    for (int i = 0; i < MARKER_CIRCLE_VERTICES - 1; i++) {
+        float angle = (2.0f * 3.14159f * i) / MARKER_CIRCLE_SEGMENTS;
+        circle.push_back(cos(angle));
+        circle.push_back(sin(angle));
+        circle.push_back(0.5f + 0.5f * cos(angle));
+        circle.push_back(0.5f + 0.5f * sin(angle));
+    }
+    float quad[] = {
+        -0.5f, -0.5f,   0.0f, 0.0f,
+         0.5f, -0.5f,   1.0f, 0.0f,
+         0.5f,  0.5f,   1.0f, 1.0f,
+        -0.5f,  0.5f,   0.0f, 1.0f
+    };
+
+    glGenBuffers(1, &instanceVBO);
+    glGenVertexArrays(1, &circleVAO);
+    glGenBuffers(1, &circleVBO);
+    glGenVertexArrays(1, &labelVAO);
+    glGenBuffers(1, &labelVBO);
+
+    unsigned int vaos[2] = { circleVAO, labelVAO };
+    unsigned int vbos[2] = { circleVBO, labelVBO };
+    const float* data[2] = { circle.data(), quad };
+    size_t sizes[2] = { circle.size() * sizeof(float), sizeof(quad) };
+    for (int k = 0; k < 2; k++) {
+        glState.bindVertexArray(vaos[k]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[k]);
+        glBufferData(GL_ARRAY_BUFFER, sizes[k], data[k], GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        setupInstanceAttributes(0);
+    }
+    glState.bindVertexArray(0);
+    return true;
+}
+
+void StationMarkers::destroy() {
+    glDeleteVertexArrays(1, &circleVAO);
+    glDeleteBuffers(1, &circleVBO);
+    glDeleteVertexArrays(1, &labelVAO);
+    glDeleteBuffers(1, &labelVBO);
+    glDeleteBuffers(1, &instanceVBO);
+    shader.destroy();
+}
+
+bool StationMarkers::update(const Station* stations, int stationCount, unsigned int routeVersion, const TextureAtlas& atlas) {
+    if (built && routeVersion == builtVersion && stationCount == count) {
+        return false;
+    }
+
+    instances.resize((size_t)stationCount * 2);
+    labelTexture = atlas[ASSET_NUMBER_0].texture;
+    for (int i = 0; i < stationCount; i++) {
+        MarkerInstance& circle = instances[i];
+        circle.x = stations[i].position.x;
+        circle.y = stations[i].position.y;
+        circle.width = circle.height = style.radius;
+        circle.r = style.color[0];
+        circle.g = style.color[1];
+        circle.b = style.color[2];
+        circle.a = 1.0f;
+        circle.uv = UV_FULL;
+
+        // Oznaka je cifra broja stanice iz atlasa; sve cifre moraju biti na istoj stranici
+        const AtlasSprite& digit = atlas[ASSET_NUMBER_0 + stations[i].number % 10];
+        if (digit.texture != labelTexture && !built) {
+            std::cout << "GRESKA: cifre nisu na istoj stranici atlasa" << std::endl;
+        }
+        MarkerInstance& label = instances[(size_t)stationCount + i];
+        label = circle;
+        label.width = style.labelWidth;
+        label.height = style.labelHeight;
+        label.r = label.g = label.b = 1.0f;
+        label.uv = digit.uv;
+    }
+
+    // Velicina se menja samo sa brojem stanica; inace se sadrzaj prepisuje na mestu
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    size_t bytes = instances.size() * sizeof(MarkerInstance);
+    if (stationCount != count || !built) {
+        glBufferData(GL_ARRAY_BUFFER, bytes, instances.data(), GL_DYNAMIC_DRAW);
+        // Brojevi pocinju posle krugova, pa se pomeraj u baferu menja sa brojem stanica
+        glState.bindVertexArray(labelVAO);
+        setupInstanceAttributes((size_t)stationCount);
+        glState.bindVertexArray(0);
+    }
+    else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, instances.data());
+    }
+
+    count = stationCount;
+    builtVersion = routeVersion;
+    built = true;
+    return true;
+}
+
+void StationMarkers::draw() const {
+    if (count == 0) {
+        return;
+    }
+    shader.use();
+    glState.setEnabled(GL_BLEND, true);
+    glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    ShaderProgram::set(useTextureUniform, 0);
+    glState.bindVertexArray(circleVAO);
+    glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, MARKER_CIRCLE_VERTICES, count);
+
+    ShaderProgram::set(useTextureUniform, 1);
+    glState.bindTexture(TEXTURE_UNIT_SPRITES, labelTexture);
+    glState.bindVertexArray(labelVAO);
+    glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, 4, count);
+}
@@ -0,0 +1,130 @@
+#include "../Header/TextureAtlas.h"
+#include "../Header/AtlasPacker.h"
+#include "../Header/Util.h"
+#include "../Header/stb_image.h"
+
+#include <cstring>
+#include <iostream>
+
+static const char* ASSET_PATHS[ASSET_NUMBER_0] = {
+    "Resource Files/Textures/2d_bus.png",
+    "Resource Files/Textures/bus_station.png",
+    "Resource Files/Textures/bus_control.png",
+    "Resource Files/Textures/closed_doors.png",
+    "Resource Files/Textures/opened_doors.png",
+    "Resource Files/Textures/author_text.png",
+    "Resource Files/Textures/passangers_label.png",
+    "Resource Files/Textures/fines.png"
+};
+
+static const char* NUMBER_PATHS[10] = {
+    "Resource Files/Textures/number_0.png", "Resource Files/Textures/number_1.png",
+    "Resource Files/Textures/number_2.png", "Resource Files/Textures/number_3.png",
+    "Resource Files/Textures/number_4.png", "Resource Files/Textures/number_5.png",
+    "Resource Files/Textures/number_6.png", "Resource Files/Textures/number_7.png",
+    "Resource Files/Textures/number_8.png", "Resource Files/Textures/number_9.png"
+};
+
+const char* assetPath(int asset) {
+    return asset < ASSET_NUMBER_0 ? ASSET_PATHS[asset] : NUMBER_PATHS[asset - ASSET_NUMBER_0];
+}
+
+struct AtlasImage {
+    unsigned char* pixels;   // uvek RGBA, redovi odozgo nadole kako ih daje stbi_load
+    int width, height;
+};
+
+// Kopira sliku u stranicu i prosiruje njenu ivicu za "padding" piksela na sve strane
+static void blitPadded(unsigned char* page, int pageSize, const AtlasImage& image, int x, int y, int padding) {
+    for (int row = -padding; row < image.height + padding; row++) {
+        int srcRow = row < 0 ? 0 : (row >= image.height ? image.height - 1 : row);
+        unsigned char* dst = page + ((size_t)(y + row) * pageSize + x) * 4;
+        const unsigned char* src = image.pixels + (size_t)srcRow * image.width * 4;
+        memcpy(dst, src, (size_t)image.width * 4);
+        for (int p = 1; p <= padding; p++) {
+            memcpy(dst - p * 4, src, 4);
+            memcpy(dst + (image.width - 1 + p) * 4, src + (image.width - 1) * 4, 4);
+        }
+    }
+}
+
+bool TextureAtlas::build(int pageSize, SamplerPreset sampler) {
+    AtlasImage images[ASSET_COUNT];
+    int widths[ASSET_COUNT], heights[ASSET_COUNT];
+    bool loaded = true;
+    for (int i = 0; i < ASSET_COUNT; i++) {
+        int channels = 0;
+        // Trazi se RGBA bez obzira na broj kanala u fajlu, da sve slike imaju isti format kao stranica
+        images[i].pixels = stbi_load(assetPath(i), &images[i].width, &images[i].height, &channels, 4);
+        if (images[i].pixels == NULL) {
+            std::cout << "Textura nije ucitana! Putanja texture: " << assetPath(i) << std::endl;
+            images[i].width = images[i].height = 1;
+            loaded = false;
+        }
+        widths[i] = images[i].width;
+        heights[i] = images[i].height;
+    }
+
+    AtlasPlacement placements[ASSET_COUNT];
+    int pageCount = loaded ? packAtlas(widths, heights, ASSET_COUNT, pageSize, pageSize, ATLAS_PADDING, placements) : 0;
+
+    std::vector<unsigned char> pixels;
+    for (int page = 0; page < pageCount; page++) {
+        pixels.assign((size_t)pageSize * pageSize * 4, 0);
+        for (int i = 0; i < ASSET_COUNT; i++) {
+            if (placements[i].page == page) {
+                blitPadded(pixels.data(), pageSize, images[i], placements[i].x, placements[i].y, ATLAS_PADDING);
+            }
+        }
+
+        // Kao u loadImageToTexture: OpenGL ocekuje prvi red na dnu, pa se stranica okrece jednom
+        std::vector<unsigned char> row((size_t)pageSize * 4);
+        for (int top = 0, bottom = pageSize - 1; top < bottom; top++, bottom--) {
+            unsigned char* a = &pixels[(size_t)top * pageSize * 4];
+            unsigned char* b = &pixels[(size_t)bottom * pageSize * 4];
+            memcpy(row.data(), a, row.size());
+            memcpy(a, b, row.size());
+            memcpy(b, row.data(), row.size());
+        }
+
+        unsigned int texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pageSize, pageSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        applySamplerToTexture(texture, sampler);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        pages.push_back(texture);
+    }
+
+    for (int i = 0; i < ASSET_COUNT; i++) {
+        if (images[i].pixels != NULL) {
+            stbi_image_free(images[i].pixels);
+        }
+        if (pageCount == 0) {
+            continue;
+        }
+        // Posle okretanja red y (odozgo) je na visini pageSize - y, pa v raste nagore kao kod pojedinacnih tekstura
+        float scale = 1.0f / pageSize;
+        const AtlasPlacement& p = placements[i];
+        sprites[i].texture = pages[p.page];
+        sprites[i].uv.u0 = p.x * scale;
+        sprites[i].uv.u1 = (p.x + widths[i]) * scale;
+        sprites[i].uv.v0 = (pageSize - p.y - heights[i]) * scale;
+        sprites[i].uv.v1 = (pageSize - p.y) * scale;
+    }
+
+    if (loaded && pageCount == 0) {
+        std::cout << "GRESKA: slika ne staje u stranicu atlasa " << pageSize << "x" << pageSize << std::endl;
+    }
+    return pageCount > 0;
+}
+
+void TextureAtlas::destroy() {
+    for (size_t i = 0; i < pages.size(); i++) {
+        forgetTextureSampler(pages[i]);
+    }
+    if (!pages.empty()) {
+        glDeleteTextures((GLsizei)pages.size(), pages.data());
+    }
+    pages.clear();
+}
@@ -0,0 +1,78 @@
+#include "../Header/TimeWarp.h"
+
+#include <chrono>
+
+typedef std::chrono::steady_clock WarpClock;
+
+TimeWarp::TimeWarp() {
+    scaleIndex = 0;
+    accumulator = 0.0;
+    budget = TIME_WARP_BUDGET;
+    totalSteps = 0;
+    totalDroppedSteps = 0;
+}
+
+float TimeWarp::scale() const {
+    return TIME_WARP_SCALES[scaleIndex];
+}
+
+void TimeWarp::faster() {
+    if (scaleIndex + 1 < TIME_WARP_SCALE_COUNT) {
+        scaleIndex++;
+    }
+}
+
+void TimeWarp::slower() {
+    if (scaleIndex > 0) {
+        scaleIndex--;
+    }
+}
+
+void TimeWarp::resetScale() {
+    scaleIndex = 0;
+}
+
+unsigned TimeWarp::advance(Simulation& simulation, float frameDt, TimeWarpStats* stats, SimulationEventCallback onEvents) {
+    if (frameDt > TIME_WARP_MAX_FRAME_DT) {
+        frameDt = TIME_WARP_MAX_FRAME_DT;
+    }
+    accumulator += (double)frameDt * scale();
+    uint64_t pending = (uint64_t)(accumulator / SIMULATION_DT);
+    accumulator -= pending * (double)SIMULATION_DT;
+
+    unsigned events = EVENT_NONE;
+    uint64_t done = 0;
+    WarpClock::time_point start = WarpClock::now();
+    double elapsed = 0.0;
+
+    // Sat se cita na svakih TIME_WARP_CHUNK koraka, jer je jedan korak mnogo kraci od citanja sata
+    while (done < pending) {
+        uint64_t chunk = pending - done;
+        if (chunk > (uint64_t)TIME_WARP_CHUNK) {
+            chunk = TIME_WARP_CHUNK;
+        }
+        for (uint64_t i = 0; i < chunk; i++) {
+            unsigned stepEvents = simulation.step(SIMULATION_DT);
+            if (stepEvents != EVENT_NONE && onEvents != 0) {
+                onEvents(stepEvents, simulation.state);
+            }
+            events |= stepEvents;
+        }
+        done += chunk;
+
+        std::chrono::duration<double> d = WarpClock::now() - start;
+        elapsed = d.count();
+        if (elapsed >= budget) {
+            break;
+        }
+    }
+
+    totalSteps += done;
+    totalDroppedSteps += pending - done;
+    if (stats != 0) {
+        stats->steps = done;
+        stats->droppedSteps = pending - done;
+        stats->seconds = elapsed;
+    }
+    return events;
+}
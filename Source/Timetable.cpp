@@ -0,0 +1,157 @@
+#include "../Header/Timetable.h"
+#include "../Header/Route.h"
+
+#include <algorithm>
+
+uint64_t ticksUntil(float limit, float increment) {
+    float sum = 0.0f;
+    uint64_t ticks = 0;
+    while (sum < limit) {
+        sum += increment;
+        ticks++;
+    }
+    return ticks;
+}
+
+Timetable::Timetable() {
+    stationCount = 0;
+    cycleTicks = 0;
+}
+
+// ========== IZGRADNJA ==========
+void Timetable::build(int count, const uint64_t* dwellTicks, const uint64_t* travelTicks) {
+    stationCount = count;
+    arrivalOffset.resize(count);
+    departureOffset.resize(count);
+    progressPerTick.resize(count);
+    uint64_t time = 0;
+    for (int s = 0; s < count; s++) {
+        arrivalOffset[s] = time;
+        time += dwellTicks[s];
+        departureOffset[s] = time;
+        progressPerTick[s] = 1.0f / travelTicks[s];
+        time += travelTicks[s];
+    }
+    cycleTicks = time;
+
+    // Pocetci autobusa su po modulu starog kruga, pa se posle promene trajanja svode na nov i ponovo sortiraju
+    std::vector<std::pair<uint64_t, int> > order(busCount());
+    for (int b = 0; b < busCount(); b++) {
+        busOrigin[b] %= cycleTicks;
+        order[b] = std::make_pair(busOrigin[b], b);
+    }
+    std::sort(order.begin(), order.end());
+    for (int i = 0; i < busCount(); i++) {
+        sortedOrigins[i] = order[i].first;
+        sortedBuses[i] = order[i].second;
+    }
+}
+
+void Timetable::build(const RouteGeometry& route) {
+    // Napredak je udeo luka, pa svaki segment traje isto bez obzira na duzinu
+    int count = route.segmentCount();
+    uint64_t dwell = ticksUntil(STATION_WAIT_TIME, SIMULATION_DT);
+    uint64_t travel = ticksUntil(1.0f, BUS_SPEED * SIMULATION_DT);
+    std::vector<uint64_t> dwellTicks(count, dwell);
+    std::vector<uint64_t> travelTicks(count, travel);
+    build(count, dwellTicks.data(), travelTicks.data());
+    // Isti prirast kao u Simulation::step, da se i napredak poklapa, ne samo tikovi
+    progressPerTick.assign(count, BUS_SPEED * SIMULATION_DT);
+}
+
+// ========== AUTOBUSI ==========
+int Timetable::addBus(uint64_t origin) {
+    // Pre build() nema trajanja kruga (deljenje nulom), pa ni autobusa
+    if (cycleTicks == 0) {
+        return -1;
+    }
+    origin %= cycleTicks;
+    int bus = busCount();
+    busOrigin.push_back(origin);
+    size_t at = std::upper_bound(sortedOrigins.begin(), sortedOrigins.end(), origin) - sortedOrigins.begin();
+    sortedOrigins.insert(sortedOrigins.begin() + at, origin);
+    sortedBuses.insert(sortedBuses.begin() + at, bus);
+    return bus;
+}
+
+void Timetable::setOrigin(int bus, uint64_t origin) {
+    origin %= cycleTicks;
+    // Stari polozaj u sortiranom nizu: prvi sa istim pocetkom, pa linearno do trazenog autobusa
+    size_t from = std::lower_bound(sortedOrigins.begin(), sortedOrigins.end(), busOrigin[bus]) - sortedOrigins.begin();
+    while (sortedBuses[from] != bus) {
+        from++;
+    }
+    size_t to = std::upper_bound(sortedOrigins.begin(), sortedOrigins.end(), origin) - sortedOrigins.begin();
+
+    // Pomeraju se samo elementi izmedju starog i novog mesta
+    if (to > from) {
+        to--;
+        std::move(sortedOrigins.begin() + from + 1, sortedOrigins.begin() + to + 1, sortedOrigins.begin() + from);
+        std::move(sortedBuses.begin() + from + 1, sortedBuses.begin() + to + 1, sortedBuses.begin() + from);
+    }
+    else {
+        std::move_backward(sortedOrigins.begin() + to, sortedOrigins.begin() + from, sortedOrigins.begin() + from + 1);
+        std::move_backward(sortedBuses.begin() + to, sortedBuses.begin() + from, sortedBuses.begin() + from + 1);
+    }
+    sortedOrigins[to] = origin;
+    sortedBuses[to] = bus;
+    busOrigin[bus] = origin;
+}
+
+void Timetable::syncBus(int bus, int station, bool atStation, float stationTimer, float progress, uint64_t tick) {
+    // Faza u krugu iz zivog stanja; zaokruzivanje na tik je dovoljno jer se sinhronizuje na svakom dogadjaju
+    uint64_t phase;
+    if (atStation) {
+        phase = arrivalOffset[station] + (uint64_t)(stationTimer / SIMULATION_DT + 0.5f);
+    }
+    else {
+        phase = departureOffset[station] + (uint64_t)(progress / progressPerTick[station] + 0.5f);
+    }
+    phase %= cycleTicks;
+    setOrigin(bus, (tick % cycleTicks + cycleTicks - phase) % cycleTicks);
+}
+
+void Timetable::syncBus(int bus, const SimulationState& state) {
+    syncBus(bus, state.currentStation, state.busAtStation, state.stationTimer, state.busProgress, state.tick);
+}
+
+// ========== UPITI ==========
+uint64_t Timetable::nextArrival(int station, uint64_t tick, int* bus) const {
+    if (sortedOrigins.empty()) {
+        if (bus != 0) *bus = -1;
+        return UINT64_MAX;
+    }
+    // Autobus sa pocetkom o stize na stanicu u o + offset (mod krug); trazi se najmanji o >= tick - offset
+    uint64_t offset = arrivalOffset[station];
+    uint64_t target = (tick % cycleTicks + cycleTicks - offset % cycleTicks) % cycleTicks;
+    size_t i = std::lower_bound(sortedOrigins.begin(), sortedOrigins.end(), target) - sortedOrigins.begin();
+    uint64_t wait;
+    if (i < sortedOrigins.size()) {
+        wait = sortedOrigins[i] - target;
+    }
+    else {
+        // Nema ih vise u ovom krugu, prvi u sledecem
+        i = 0;
+        wait = sortedOrigins[0] + cycleTicks - target;
+    }
+    if (bus != 0) *bus = sortedBuses[i];
+    return tick + wait;
+}
+
+BusPosition Timetable::busPosition(int bus, uint64_t tick) const {
+    uint64_t phase = (tick % cycleTicks + cycleTicks - busOrigin[bus]) % cycleTicks;
+    // Poslednja stanica na koju je stigao do ove faze
+    int s = (int)(std::upper_bound(arrivalOffset.begin(), arrivalOffset.end(), phase) - arrivalOffset.begin()) - 1;
+
+    BusPosition position;
+    position.segment = s;
+    position.atStation = phase < departureOffset[s];
+    if (position.atStation) {
+        position.progress = 0.0f;
+    }
+    else {
+        float progress = (float)(phase - departureOffset[s]) * progressPerTick[s];
+        position.progress = progress < 1.0f ? progress : 1.0f;
+    }
+    return position;
+}
@@ -97,7 +97,7 @@ unsigned int createShader(const char* vsSource, const char* fsSource)
     return program;
 }
 
-unsigned loadImageToTexture(const char* filePath) {
+unsigned loadImageToTexture(const char* filePath, SamplerPreset sampler) {
     int TextureWidth;
     int TextureHeight;
     int TextureChannels;
@@ -121,6 +121,8 @@ unsigned loadImageToTexture(const char* filePath) {
         glGenTextures(1, &Texture);
         glBindTexture(GL_TEXTURE_2D, Texture);
         glTexImage2D(GL_TEXTURE_2D, 0, InternalFormat, TextureWidth, TextureHeight, 0, InternalFormat, GL_UNSIGNED_BYTE, ImageData);
+        // Parametri uzorkovanja se postavljaju samo ovde, pri ucitavanju (vidi Samplers.h)
+        applySamplerToTexture(Texture, sampler);
         glBindTexture(GL_TEXTURE_2D, 0);
         // oslobadjanje memorije zauzete sa stbi_load posto vise nije potrebna
         stbi_image_free(ImageData);